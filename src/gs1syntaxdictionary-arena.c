@@ -0,0 +1,179 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-arena.c
+ *
+ * @brief A bump allocator over memory provided by the caller.
+ *
+ * Functions that need working memory beyond the stack, such as the loading of
+ * the Syntax Dictionary into a store created with gs1_dict_store_new_arena(),
+ * take it from an arena rather than from the heap. Allocation is a bounds
+ * check and an addition, nothing is freed individually, and everything that
+ * was allocated is released at once by gs1_arena_reset().
+ *
+ * An arena is not thread safe. Each thread should own its own arena, so that
+ * threads never contend for the process-wide allocator.
+ *
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ * Allocations from an arena are aligned for any of the types held by the
+ * library.
+ *
+ */
+typedef union {
+	void *p;
+	uint64_t u;
+	double d;
+	gs1_linter_t fn;
+} arena_align_t;
+
+#define ARENA_ALIGN sizeof(arena_align_t)
+
+
+/**
+ * Initialise an arena over memory provided by the caller.
+ *
+ * The memory need not be aligned. It must remain available, and must not be
+ * otherwise used, for as long as anything allocated from the arena is in use.
+ *
+ * @param [out] arena The arena to initialise. Must not be `NULL`.
+ * @param [in] mem The memory. Must not be `NULL`.
+ * @param [in] size Size of the memory in bytes.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_arena_init(gs1_arena_t* const arena, void* const mem, const size_t size)
+{
+
+	assert(arena);
+	assert(mem);
+
+	arena->base = (unsigned char *)mem;
+	arena->size = size;
+	arena->used = 0;
+
+}
+
+
+/**
+ * Allocate memory from an arena.
+ *
+ * @param [in,out] arena The arena. Must not be `NULL`.
+ * @param [in] size Number of bytes required.
+ *
+ * @return Memory that is suitably aligned for any type used by the library,
+ *         valid until the arena is reset.
+ * @return `NULL` if the arena has insufficient space remaining, in which case
+ *         the arena is unchanged.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void* gs1_arena_alloc(gs1_arena_t* const arena, const size_t size)
+{
+
+	size_t pad;
+
+	assert(arena);
+
+	pad = (size_t)(-(uintptr_t)(arena->base + arena->used)) & (ARENA_ALIGN - 1);
+
+	if (GS1_LINTER_UNLIKELY(arena->size - arena->used < pad ||
+				arena->size - arena->used - pad < size))
+		return NULL;
+
+	arena->used += pad + size;
+
+	return arena->base + arena->used - size;
+
+}
+
+
+/**
+ * Release everything that has been allocated from an arena, so that its
+ * memory can be reused.
+ *
+ * @param [in,out] arena The arena. Must not be `NULL`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_arena_reset(gs1_arena_t* const arena)
+{
+	assert(arena);
+	arena->used = 0;
+}
+
+
+#undef ARENA_ALIGN
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+void test_gs1_arena(void)
+{
+
+	static arena_align_t mem[8];
+	gs1_arena_t arena;
+	unsigned char *p, *q;
+
+	gs1_arena_init(&arena, (unsigned char *)mem + 1, sizeof(mem) - 1);
+	TEST_CHECK(arena.used == 0);
+
+	TEST_ASSERT((p = (unsigned char *)gs1_arena_alloc(&arena, 1)) != NULL);
+	TEST_CHECK((uintptr_t)p % sizeof(arena_align_t) == 0);
+	TEST_CHECK(p == (unsigned char *)&mem[1]);
+
+	TEST_ASSERT((q = (unsigned char *)gs1_arena_alloc(&arena, 3)) != NULL);
+	TEST_CHECK((uintptr_t)q % sizeof(arena_align_t) == 0);
+	TEST_CHECK(q == p + sizeof(arena_align_t));
+
+	/*
+	 *  A request larger than the remaining space fails, leaving it to be
+	 *  filled exactly.
+	 *
+	 */
+	TEST_CHECK(gs1_arena_alloc(&arena, sizeof(mem)) == NULL);
+	TEST_ASSERT(gs1_arena_alloc(&arena, sizeof(mem) - 3 * sizeof(arena_align_t)) != NULL);
+	TEST_CHECK(arena.used == arena.size);
+	TEST_CHECK(gs1_arena_alloc(&arena, 0) != NULL);
+
+	/*
+	 *  Space remains, but not enough for the alignment padding.
+	 *
+	 */
+	gs1_arena_init(&arena, (unsigned char *)mem, 5);
+	TEST_CHECK(gs1_arena_alloc(&arena, 1) != NULL);
+	TEST_CHECK(gs1_arena_alloc(&arena, 0) == NULL);
+	TEST_CHECK(arena.used == 1);
+
+	gs1_arena_reset(&arena);
+	TEST_CHECK(arena.used == 0);
+	TEST_CHECK(gs1_arena_alloc(&arena, 5) == (void *)mem);
+
+}
+
+#endif  /* UNIT_TESTS */
@@ -0,0 +1,1176 @@
+/**
+ * GS1 Barcode Syntax Dictionary
+ *
+ * @author Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Microbenchmarks for the linters.
+ *
+ * Every linter in name_function_map is run over a corpus of valid inputs and
+ * a corpus of invalid inputs, each of typical length for the AIs that use the
+ * linter. The linter is called through its function pointer, as a framework
+ * driven by the Syntax Dictionary would.
+ *
+ * Each measurement is calibrated to run for a target time, preceded by
+ * warm-up runs that are discarded, then repeated to give the median, minimum
+ * and relative standard deviation of the time per call. The process is pinned
+ * to a single CPU where the platform allows.
+ *
+ * With -d and -e an end-to-end benchmark is run instead, over a corpus of
+ * element strings such as those produced by gs1syntaxdictionary-corpus-gen.
+ * Each element string is split into AIs and components using the Syntax
+ * Dictionary and every component is passed through its full chain of
+ * checks, so that the cost of dispatch and of mispredicted branches between
+ * linters is included.
+ *
+ * With -o the results of every repetition are saved as a JSON baseline. With
+ * -b the results are compared with a baseline using the Mann-Whitney U test,
+ * which makes no assumption about the distribution of the timings, and the
+ * exit status is non-zero if any linter has become slower by more than its
+ * threshold (-T) with a significant difference.
+ *
+ * Usage:
+ *
+ *     gs1syntaxdictionary-bench [options] [linter ...]
+ *     gs1syntaxdictionary-bench -d gs1-syntax-dictionary.txt -e labels.txt [options]
+ *
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+#include "gs1syntaxdictionary-bench.h"
+
+
+#define BENCH_MAX_SAMPLES 8
+#define BENCH_MAX_REPS 101
+#define BENCH_MAX_RESULTS 128
+#define BENCH_MAX_THRESHOLDS 32
+#define BENCH_ALPHA 0.05	// Significance level for comparison with a baseline
+
+
+/*
+ *  Representative inputs for each linter. The invalid inputs fail late where
+ *  the linter allows, so that most of the input is processed.
+ *
+ *  Deprecated stubs have no invalid inputs.
+ *
+ */
+static const struct bench_corpus_s {
+	const char *name;
+	const char *valid[BENCH_MAX_SAMPLES];
+	const char *invalid[BENCH_MAX_SAMPLES];
+} corpora[] = {
+	{ "couponcode",
+		{ "106141411234562891101201212085010048000214025610048000310123191000",
+		  "1061414154321031501101201211014092110256100126663101231",
+		  "106141416543213500110000310123196000" },
+		{ "10614141654321350011000031012319600",
+		  "1061414154321031501101201211014092110256100126663101239" } },
+	{ "couponposoffer",
+		{ "061234567890121234569123456789012345",
+		  "001234561234569123456789012345",
+		  "00123456123456812345678901234" },
+		{ "0612345678901212345691234567890123456",
+		  "06123456789012123456912345678901234" } },
+	{ "cset39",
+		{ "ABC123-DEF/456#GHI", "PART-NO/0042#X" },
+		{ "ABC123-DEF/456#GHi", "PART-NO/0042#x" } },
+	{ "cset64",
+		{ "ABCdef123-_xyzXYZ78==", "d2VsY29tZS10by1nczE_" },
+		{ "ABCdef123-_xyz+YZ78==", "d2VsY29tZS10by1nczE/" } },
+	{ "cset82",
+		{ "ABC-123/xyz.abc_DEF!%", "LOT:2024(A)*B+C" },
+		{ "ABC-123/xyz.abc_DEF!~", "LOT:2024(A)*B+C#" } },
+	{ "csetnumeric",
+		{ "01234567890123456789", "095011010209" },
+		{ "0123456789012345678A", "09501101020A" } },
+	{ "csum",
+		{ "09501101020917", "950110153007", "095011015300000010" },
+		{ "09501101020918", "950110153000", "095011015300000011" } },
+	{ "csumalpha",
+		{ "1987654Ad4X4bL5ttr2310c2K", "12345678901234567890123NT" },
+		{ "1987654Ad4X4bL5ttr2310c2L", "12345678901234567890123NU" } },
+	{ "gcppos1",
+		{ "9501101021037", "0614141000012" },
+		{ "95A1101021037", "061A141000012" } },
+	{ "gcppos2",
+		{ "09501101020917", "10614141000019" },
+		{ "0950A101020917", "1061A141000019" } },
+	{ "hasnondigit",
+		{ "1234567890ABC", "ABC1234567890" },
+		{ "12345678901234", "123456" } },
+	{ "hh",
+		{ "23", "09" },
+		{ "24", "99" } },
+	{ "hhmi",
+		{ "2359", "0930" },
+		{ "2360", "2400" } },
+	{ "hhmm",
+		{ "2359" },
+		{ NULL } },
+	{ "hyphen",
+		{ "-", "--" },
+		{ "X", "-X" } },
+	{ "iban",
+		{ "GB82WEST12345698765432", "DE89370400440532013000", "MT90MALT011000012345MTLCAST001SABC" },
+		{ "GB82WEST12345698765433", "DE89370400440532013001", "MT90MALT011000012345MTLCAST001SABD" } },
+	{ "importeridx",
+		{ "A", "z", "-" },
+		{ "!", "#" } },
+	{ "iso3166",
+		{ "826", "276", "840" },
+		{ "999", "000" } },
+	{ "iso3166999",
+		{ "999", "826", "276" },
+		{ "998", "000" } },
+	{ "iso3166alpha2",
+		{ "GB", "DE", "US" },
+		{ "ZZ", "XX" } },
+	{ "iso3166list",
+		{ "826276840" },
+		{ NULL } },
+	{ "iso4217",
+		{ "978", "840", "826" },
+		{ "000", "998" } },
+	{ "iso5218",
+		{ "0", "1", "2", "9" },
+		{ "3", "8" } },
+	{ "key",
+		{ "9501101021037" },
+		{ NULL } },
+	{ "keyoff1",
+		{ "09501101020917" },
+		{ NULL } },
+	{ "latitude",
+		{ "0279085848", "1800000000" },
+		{ "1800000001", "1900000000" } },
+	{ "longitude",
+		{ "3015297971", "3600000000" },
+		{ "3600000001", "3700000000" } },
+	{ "mediatype",
+		{ "01", "10" },
+		{ "00", "79" } },
+	{ "mi",
+		{ "59", "00" },
+		{ "60", "99" } },
+	{ "mmoptss",
+		{ "5959" },
+		{ NULL } },
+	{ "nonzero",
+		{ "00001000", "000000000001" },
+		{ "00000000", "000000000000" } },
+	{ "nozeroprefix",
+		{ "1234567890", "9" },
+		{ "0123456789", "01" } },
+	{ "packagetype",
+		{ "BX", "CT", "PX", "1A" },
+		{ "ZZZ", "Q1" } },
+	{ "pcenc",
+		{ "ABC%20XYZ%2Fabc", "LOT%2B2024" },
+		{ "ABC%20XYZ%2Gabc", "LOT%2" } },
+	{ "pieceoftotal",
+		{ "003005", "001001" },
+		{ "006005", "000005" } },
+	{ "posinseqslash",
+		{ "12/100", "1/1" },
+		{ "101/100", "0/1" } },
+	{ "ss",
+		{ "59", "00" },
+		{ "60", "99" } },
+	{ "winding",
+		{ "0", "1", "9" },
+		{ "2", "8" } },
+	{ "yesno",
+		{ "0", "1" },
+		{ "2", "9" } },
+	{ "yymmd0",
+		{ "241231", "240200" },
+		{ "241232", "241301" } },
+	{ "yymmdd",
+		{ "241231", "240229" },
+		{ "241200", "230229" } },
+	{ "yymmddhh",
+		{ "24123123" },
+		{ NULL } },
+	{ "yyyymmd0",
+		{ "20241231", "20240200" },
+		{ "20241232", "20241301" } },
+	{ "yyyymmdd",
+		{ "20241231", "20240229" },
+		{ "20241200", "20230229" } },
+	{ "zero",
+		{ "0", "000" },
+		{ "01", "X" } },
+};
+
+
+struct bench_sample_s {
+	const char *data;
+	size_t len;
+};
+
+struct bench_threshold_s {
+	const char *name;
+	double percent;
+};
+
+struct bench_opts_s {
+	unsigned int reps;
+	unsigned int warmups;
+	double target_ns;
+	int cpu;
+	char **only;
+	int only_num;
+	const char *save_path;
+	const char *baseline_path;
+	double threshold;
+	struct bench_threshold_s thresholds[BENCH_MAX_THRESHOLDS];
+	size_t thresholds_num;
+};
+
+
+/*
+ *  Time per operation for each repetition of each measurement, for saving as
+ *  a baseline or comparing with one.
+ *
+ */
+struct bench_result_s {
+	char name[32];
+	char corpus[16];
+	unsigned int reps;
+	double ns[BENCH_MAX_REPS];
+};
+
+static struct bench_result_s results[BENCH_MAX_RESULTS];
+static size_t results_num;
+
+
+static volatile unsigned long bench_sink;
+
+
+/*
+ *  Monotonic time in nanoseconds.
+ *
+ */
+static double bench_now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+
+/*
+ *  Cycle counter. Core cycles from the kernel's performance counters where
+ *  available, otherwise the time-stamp counter, which runs at a fixed
+ *  reference frequency.
+ *
+ */
+#ifdef __linux__
+static int perf_fd = -1;
+#endif
+static const char *cycles_source = "none";
+
+static void bench_cycles_init(void)
+{
+
+#ifdef __linux__
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	perf_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	if (perf_fd >= 0) {
+		ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+		cycles_source = "core cycles (perf)";
+		return;
+	}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+	cycles_source = "TSC reference cycles";
+#endif
+
+}
+
+static bool bench_cycles(uint64_t* const cycles)
+{
+
+#ifdef __linux__
+	if (perf_fd >= 0)
+		return read(perf_fd, cycles, sizeof(*cycles)) == (ssize_t)sizeof(*cycles);
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+	*cycles = (uint64_t)__rdtsc();
+	return true;
+#else
+	(void)cycles;
+	return false;
+#endif
+
+}
+
+
+static void bench_pin(const int cpu)
+{
+
+#ifdef __linux__
+	cpu_set_t set;
+	const int target = cpu >= 0 ? cpu : sched_getcpu();
+
+	if (target < 0)
+		return;
+	CPU_ZERO(&set);
+	CPU_SET((size_t)target, &set);
+	if (sched_setaffinity(0, sizeof(set), &set) == 0)
+		printf("Pinned to CPU %d\n", target);
+	else
+		printf("Unable to pin to CPU %d\n", target);
+#else
+	(void)cpu;
+	printf("CPU pinning is not supported on this platform\n");
+#endif
+
+}
+
+
+/*
+ *  Call the linter `iters` times, cycling through the samples. Returns the
+ *  elapsed time in nanoseconds, and the elapsed cycles if available.
+ *
+ */
+static double bench_run(const gs1_linter_t fn, const struct bench_sample_s* const samples, const size_t num, const size_t iters, uint64_t* const cycles, bool* const have_cycles)
+{
+
+	size_t i, j = 0, err_pos, err_len;
+	unsigned long sink = 0;
+	uint64_t c0 = 0, c1 = 0;
+	double t0, t1;
+
+	*have_cycles = bench_cycles(&c0);
+	t0 = bench_now_ns();
+
+	for (i = 0; i < iters; i++) {
+		sink += (unsigned long)fn(samples[j].data, samples[j].len, &err_pos, &err_len);
+		if (++j == num)
+			j = 0;
+	}
+
+	t1 = bench_now_ns();
+	*have_cycles = *have_cycles && bench_cycles(&c1);
+	*cycles = c1 - c0;
+
+	bench_sink += sink;
+
+	return t1 - t0;
+
+}
+
+
+static int cmp_double(const void* const a, const void* const b)
+{
+	const double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+
+/*
+ *  Summary statistics over repetitions.
+ *
+ */
+struct bench_stats_s {
+	double median;
+	double min;
+	double mean;
+	double rsd;	// Relative standard deviation, as a percentage
+};
+
+static void bench_stats(const double* const v, const size_t n, struct bench_stats_s* const st)
+{
+
+	double sorted[BENCH_MAX_REPS], sum = 0, ss = 0;
+	size_t i;
+
+	assert(n > 0 && n <= BENCH_MAX_REPS);
+
+	memcpy(sorted, v, n * sizeof(double));
+	qsort(sorted, n, sizeof(double), cmp_double);
+
+	for (i = 0; i < n; i++)
+		sum += v[i];
+	st->mean = sum / (double)n;
+	for (i = 0; i < n; i++)
+		ss += (v[i] - st->mean) * (v[i] - st->mean);
+
+	st->median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+	st->min = sorted[0];
+	st->rsd = n > 1 && st->mean > 0 ? 100 * sqrt(ss / (double)(n - 1)) / st->mean : 0;
+
+}
+
+
+static bool bench_record(struct bench_result_s* const res, size_t* const num, const char* const name, const char* const corpus, const double* const ns, const unsigned int reps)
+{
+
+	struct bench_result_s *r;
+
+	if (*num == BENCH_MAX_RESULTS || strlen(name) >= sizeof(r->name) || strlen(corpus) >= sizeof(r->corpus) || reps > BENCH_MAX_REPS)
+		return false;
+
+	r = &res[(*num)++];
+	strcpy(r->name, name);
+	strcpy(r->corpus, corpus);
+	r->reps = reps;
+	memcpy(r->ns, ns, reps * sizeof(double));
+
+	return true;
+
+}
+
+
+/*
+ *  Benchmark one linter over one corpus and print a line of results.
+ *
+ */
+static void bench_corpus(const struct bench_opts_s* const opts, const char* const name, const gs1_linter_t fn, const char* const kind, const char* const* const corpus)
+{
+
+	struct bench_sample_s samples[BENCH_MAX_SAMPLES];
+	double ns_per_op[BENCH_MAX_REPS], cycles_per_op[BENCH_MAX_REPS];
+	struct bench_stats_s ns, cyc;
+	size_t num, bytes = 0, iters = 64;
+	unsigned int r;
+	bool have_cycles = false;
+	uint64_t cycles;
+	double elapsed;
+
+	for (num = 0; num < BENCH_MAX_SAMPLES && corpus[num]; num++) {
+		samples[num].data = corpus[num];
+		samples[num].len = strlen(corpus[num]);
+		bytes += samples[num].len;
+	}
+	if (num == 0)
+		return;
+
+	/*
+	 *  Calibrate the number of calls so that each repetition runs for about
+	 *  the target time. This also serves to warm the caches and predictors.
+	 *
+	 */
+	while ((elapsed = bench_run(fn, samples, num, iters, &cycles, &have_cycles)) < opts->target_ns / 8)
+		iters *= 2;
+	iters = (size_t)((double)iters * opts->target_ns / elapsed) + 1;
+
+	for (r = 0; r < opts->warmups; r++)
+		bench_run(fn, samples, num, iters, &cycles, &have_cycles);
+
+	for (r = 0; r < opts->reps; r++) {
+		elapsed = bench_run(fn, samples, num, iters, &cycles, &have_cycles);
+		ns_per_op[r] = elapsed / (double)iters;
+		cycles_per_op[r] = have_cycles ? (double)cycles / (double)iters : 0;
+	}
+
+	bench_stats(ns_per_op, opts->reps, &ns);
+	bench_stats(cycles_per_op, opts->reps, &cyc);
+	bench_record(results, &results_num, name, kind, ns_per_op, opts->reps);
+
+	printf("%-16s %-8s %5.1f %9.2f %6.1f%% %9.2f %10.1f",
+	       name, kind, (double)bytes / (double)num, ns.median, ns.rsd, ns.min,
+	       (double)bytes / (double)num / ns.median * 1e3);
+	if (have_cycles)
+		printf(" %10.1f\n", cyc.median);
+	else
+		printf(" %10s\n", "-");
+
+}
+
+
+/*
+ *  Check that each corpus is what it claims to be, so that a change in
+ *  behaviour does not silently change what is being measured.
+ *
+ */
+static bool bench_check_corpus(const struct bench_corpus_s* const c, const gs1_linter_t fn)
+{
+
+	size_t i;
+	bool ok = true;
+
+	for (i = 0; i < BENCH_MAX_SAMPLES && c->valid[i]; i++) {
+		if (fn(c->valid[i], strlen(c->valid[i]), NULL, NULL) != GS1_LINTER_OK) {
+			fprintf(stderr, "%s: Valid sample \"%s\" is rejected\n", c->name, c->valid[i]);
+			ok = false;
+		}
+	}
+	for (i = 0; i < BENCH_MAX_SAMPLES && c->invalid[i]; i++) {
+		if (fn(c->invalid[i], strlen(c->invalid[i]), NULL, NULL) == GS1_LINTER_OK) {
+			fprintf(stderr, "%s: Invalid sample \"%s\" is accepted\n", c->name, c->invalid[i]);
+			ok = false;
+		}
+	}
+
+	return ok;
+
+}
+
+
+static const struct bench_corpus_s* bench_find_corpus(const char* const name)
+{
+	size_t i;
+	for (i = 0; i < sizeof(corpora) / sizeof(corpora[0]); i++)
+		if (strcmp(corpora[i].name, name) == 0)
+			return &corpora[i];
+	return NULL;
+}
+
+
+static bool bench_selected(const struct bench_opts_s* const opts, const char* const name)
+{
+	int i;
+	if (opts->only_num == 0)
+		return true;
+	for (i = 0; i < opts->only_num; i++)
+		if (strcmp(opts->only[i], name) == 0)
+			return true;
+	return false;
+}
+
+
+/*
+ *  Process an element string as a framework would: split it into AIs using
+ *  the Syntax Dictionary, split each AI value into its components, then run
+ *  the chain of checks for each component. Returns true if the element
+ *  string is valid.
+ *
+ */
+static bool bench_label(const gs1_dict_t* const dict, const char* p, const size_t len, size_t* const ais)
+{
+
+	const char* const end = p + len;
+
+	if (p < end && *p == BENCH_FNC1)
+		p++;
+
+	while (p < end) {
+
+		const gs1_dict_entry_t *e = NULL;
+		const char *v, *v_end;
+		size_t ai_len;
+		unsigned int k;
+
+		for (ai_len = 2; !e && ai_len <= 4 && ai_len <= (size_t)(end - p); ai_len++)
+			e = gs1_dict_lookup(dict, p, ai_len);
+		if (!e)
+			return false;
+		v = p + strlen(e->ai);
+		(*ais)++;
+
+		/*
+		 *  AIs with predefined length are not terminated by FNC1.
+		 *
+		 */
+		if (e->flags & GS1_DICT_FLAG_NO_FNC1) {
+			size_t fixed = 0;
+			for (k = 0; k < e->num_components; k++)
+				fixed += e->components[k].max;
+			if ((size_t)(end - v) < fixed)
+				return false;
+			v_end = v + fixed;
+		} else {
+			v_end = memchr(v, BENCH_FNC1, (size_t)(end - v));
+			if (!v_end)
+				v_end = end;
+		}
+
+		for (k = 0; k < e->num_components; k++) {
+			const gs1_dict_component_t *c = &e->components[k];
+			const size_t left = (size_t)(v_end - v);
+			const size_t n = c->min == c->max ? c->max : left < c->max ? left : c->max;
+			if (left == 0 && c->optional)
+				break;
+			if (n > left || !bench_lint_component(c, v, n))
+				return false;
+			v += n;
+		}
+		if (v != v_end)
+			return false;
+
+		p = v_end < end && *v_end == BENCH_FNC1 ? v_end + 1 : v_end;
+
+	}
+
+	return true;
+
+}
+
+
+struct bench_labels_s {
+	char *buf;
+	struct bench_sample_s *labels;
+	size_t num;
+	size_t bytes;
+};
+
+
+static bool bench_load_labels(const char* const path, struct bench_labels_s* const l)
+{
+
+	size_t len, pos = 0, cap = 0;
+
+	memset(l, 0, sizeof(*l));
+
+	l->buf = gs1_lint_read_file(path, SIZE_MAX / 2, &len);
+	if (!l->buf)
+		return false;
+
+	while (pos < len) {
+		const char *eol = memchr(&l->buf[pos], '\n', len - pos);
+		const size_t n = eol ? (size_t)(eol - &l->buf[pos]) : len - pos;
+		if (n > 0) {
+			if (l->num == cap) {
+				struct bench_sample_s *r;
+				cap = cap ? cap * 2 : 65536;
+				r = (struct bench_sample_s *)realloc(l->labels, cap * sizeof(struct bench_sample_s));
+				if (!r)
+					return false;
+				l->labels = r;
+			}
+			l->labels[l->num].data = &l->buf[pos];
+			l->labels[l->num].len = n;
+			l->num++;
+			l->bytes += n;
+		}
+		pos += n + 1;
+	}
+
+	return l->num > 0;
+
+}
+
+
+static double bench_e2e_run(const gs1_dict_t* const dict, const struct bench_labels_s* const l, const size_t passes, size_t* const valid, size_t* const ais, uint64_t* const cycles, bool* const have_cycles)
+{
+
+	size_t pass, i;
+	uint64_t c0 = 0, c1 = 0;
+	double t0, t1;
+
+	*valid = 0;
+	*ais = 0;
+
+	*have_cycles = bench_cycles(&c0);
+	t0 = bench_now_ns();
+
+	for (pass = 0; pass < passes; pass++)
+		for (i = 0; i < l->num; i++)
+			*valid += bench_label(dict, l->labels[i].data, l->labels[i].len, ais) ? 1 : 0;
+
+	t1 = bench_now_ns();
+	*have_cycles = *have_cycles && bench_cycles(&c1);
+	*cycles = c1 - c0;
+
+	return t1 - t0;
+
+}
+
+
+/*
+ *  End-to-end benchmark over a corpus of element strings.
+ *
+ */
+static void bench_e2e(const struct bench_opts_s* const opts, const gs1_dict_t* const dict, const struct bench_labels_s* const l)
+{
+
+	double ns_per_label[BENCH_MAX_REPS], cycles_per_label[BENCH_MAX_REPS];
+	struct bench_stats_s ns, cyc;
+	size_t passes = 1, valid, ais;
+	unsigned int r;
+	uint64_t cycles;
+	bool have_cycles;
+	double elapsed;
+
+	elapsed = bench_e2e_run(dict, l, 1, &valid, &ais, &cycles, &have_cycles);
+	if (elapsed < opts->target_ns)
+		passes = (size_t)(opts->target_ns / elapsed) + 1;
+
+	printf("Labels: %zu; AIs: %zu; bytes: %zu; valid: %zu (%.2f%%); passes per repetition: %zu\n\n",
+	       l->num, ais, l->bytes, valid, 100.0 * (double)valid / (double)l->num, passes);
+
+	for (r = 0; r < opts->warmups; r++)
+		bench_e2e_run(dict, l, passes, &valid, &ais, &cycles, &have_cycles);
+
+	for (r = 0; r < opts->reps; r++) {
+		elapsed = bench_e2e_run(dict, l, passes, &valid, &ais, &cycles, &have_cycles);
+		ns_per_label[r] = elapsed / (double)(passes * l->num);
+		cycles_per_label[r] = have_cycles ? (double)cycles / (double)(passes * l->num) : 0;
+	}
+
+	bench_stats(ns_per_label, opts->reps, &ns);
+	bench_stats(cycles_per_label, opts->reps, &cyc);
+	bench_record(results, &results_num, "end-to-end", "labels", ns_per_label, opts->reps);
+
+	printf("%-16s %9s %7s %9s %9s %10s %12s %10s\n",
+	       "", "ns/label", "rsd", "min", "ns/AI", "MB/s", "labels/s", "cycles/lbl");
+	printf("%-16s %9.2f %6.1f%% %9.2f %9.2f %10.1f %12.0f",
+	       "end-to-end", ns.median, ns.rsd, ns.min,
+	       ns.median * (double)l->num / (double)(ais / passes),
+	       (double)l->bytes / (double)l->num / ns.median * 1e3,
+	       1e9 / ns.median);
+	if (have_cycles)
+		printf(" %10.1f\n", cyc.median);
+	else
+		printf(" %10s\n", "-");
+
+}
+
+
+/*
+ *  Save the results as a JSON baseline. Each result is written on a line of
+ *  its own, which is the form that bench_load_baseline() reads.
+ *
+ */
+static bool bench_save(const char* const path)
+{
+
+	FILE *fp;
+	size_t i;
+	unsigned int r;
+
+	if (!(fp = fopen(path, "w")))
+		return false;
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"format\": \"gs1syntaxdictionary-bench\",\n");
+	fprintf(fp, "  \"version\": 1,\n");
+	fprintf(fp, "  \"cycles\": \"%s\",\n", cycles_source);
+	fprintf(fp, "  \"results\": [\n");
+	for (i = 0; i < results_num; i++) {
+		fprintf(fp, "    { \"name\": \"%s\", \"corpus\": \"%s\", \"ns\": [", results[i].name, results[i].corpus);
+		for (r = 0; r < results[i].reps; r++)
+			fprintf(fp, "%s%.4f", r ? ", " : "", results[i].ns[r]);
+		fprintf(fp, "] }%s\n", i + 1 < results_num ? "," : "");
+	}
+	fprintf(fp, "  ]\n");
+	fprintf(fp, "}\n");
+
+	return fclose(fp) == 0;
+
+}
+
+
+static bool bench_load_baseline(const char* const path, struct bench_result_s* const res, size_t* const num)
+{
+
+	char *buf, *line;
+	size_t len;
+
+	*num = 0;
+
+	if (!(buf = gs1_lint_read_file(path, 16 * 1024 * 1024, &len)))
+		return false;
+
+	for (line = strstr(buf, "{ \"name\": "); line; line = strstr(line + 1, "{ \"name\": ")) {
+
+		char name[32], corpus[16];
+		double ns[BENCH_MAX_REPS];
+		unsigned int reps = 0;
+		int off = 0;
+		char *p, *end;
+
+		if (sscanf(line, "{ \"name\": \"%31[^\"]\", \"corpus\": \"%15[^\"]\", \"ns\": [%n", name, corpus, &off) != 2 || off == 0)
+			break;
+
+		for (p = line + off; *p != ']' && reps < BENCH_MAX_REPS; p = end) {
+			ns[reps++] = strtod(p, &end);
+			if (end == p)
+				break;
+			while (*end == ',' || *end == ' ')
+				end++;
+		}
+
+		if (reps == 0 || *p != ']' || !bench_record(res, num, name, corpus, ns, reps))
+			break;
+
+	}
+
+	free(buf);
+
+	return *num > 0;
+
+}
+
+
+/*
+ *  Two-sided Mann-Whitney U test, using the normal approximation with
+ *  correction for ties and continuity. Returns the p-value for the null
+ *  hypothesis that neither sample tends to be larger than the other.
+ *
+ */
+struct bench_ranked_s {
+	double v;
+	int group;
+};
+
+static int cmp_ranked(const void* const a, const void* const b)
+{
+	return cmp_double(&((const struct bench_ranked_s *)a)->v, &((const struct bench_ranked_s *)b)->v);
+}
+
+static double bench_mann_whitney(const double* const x, const size_t nx, const double* const y, const size_t ny)
+{
+
+	struct bench_ranked_s all[2 * BENCH_MAX_REPS];
+	const size_t n = nx + ny;
+	double rank_x = 0, ties = 0, u, mu, sigma2, z;
+	size_t i, j;
+
+	for (i = 0; i < nx; i++) {
+		all[i].v = x[i];
+		all[i].group = 0;
+	}
+	for (i = 0; i < ny; i++) {
+		all[nx + i].v = y[i];
+		all[nx + i].group = 1;
+	}
+	qsort(all, n, sizeof(all[0]), cmp_ranked);
+
+	for (i = 0; i < n; i = j) {
+		double rank, t;
+		for (j = i + 1; j < n && all[j].v == all[i].v; j++)
+			;
+		rank = (double)(i + j + 1) / 2;		// Mean of ranks i+1 .. j
+		t = (double)(j - i);
+		ties += t * t * t - t;
+		for (; i < j; i++)
+			if (all[i].group == 0)
+				rank_x += rank;
+	}
+
+	u = rank_x - (double)nx * (double)(nx + 1) / 2;
+	mu = (double)nx * (double)ny / 2;
+	sigma2 = (double)nx * (double)ny / 12 * ((double)(n + 1) - ties / ((double)n * (double)(n - 1)));
+	if (sigma2 <= 0)
+		return 1;
+
+	z = (fabs(u - mu) - 0.5) / sqrt(sigma2);
+	if (z < 0)
+		z = 0;
+
+	return erfc(z / sqrt(2));
+
+}
+
+
+static double bench_threshold(const struct bench_opts_s* const opts, const char* const name)
+{
+	size_t i;
+	for (i = 0; i < opts->thresholds_num; i++)
+		if (strcmp(opts->thresholds[i].name, name) == 0)
+			return opts->thresholds[i].percent;
+	return opts->threshold;
+}
+
+
+/*
+ *  Compare the results with a baseline. A result is a regression if its
+ *  median is slower by more than the threshold and the difference is
+ *  statistically significant. Returns false if there are any regressions.
+ *
+ */
+static bool bench_compare(const struct bench_opts_s* const opts, const char* const path)
+{
+
+	static struct bench_result_s base[BENCH_MAX_RESULTS];
+	size_t base_num, i, j, regressions = 0, improvements = 0;
+
+	if (!bench_load_baseline(path, base, &base_num)) {
+		fprintf(stderr, "Unable to read a baseline from %s\n", path);
+		return false;
+	}
+
+	printf("\nComparison with %s (alpha %.2f)\n\n", path, BENCH_ALPHA);
+	printf("%-16s %-8s %9s %9s %8s %7s %8s\n",
+	       "linter", "corpus", "base", "new", "change", "p", "limit");
+
+	for (i = 0; i < results_num; i++) {
+
+		const struct bench_result_s *r = &results[i];
+		const double limit = bench_threshold(opts, r->name);
+		struct bench_stats_s st_base, st_new;
+		double change, p;
+		const char *verdict = "";
+
+		for (j = 0; j < base_num; j++)
+			if (strcmp(base[j].name, r->name) == 0 && strcmp(base[j].corpus, r->corpus) == 0)
+				break;
+		if (j == base_num) {
+			printf("%-16s %-8s %9s\n", r->name, r->corpus, "new");
+			continue;
+		}
+
+		bench_stats(base[j].ns, base[j].reps, &st_base);
+		bench_stats(r->ns, r->reps, &st_new);
+		change = 100 * (st_new.median - st_base.median) / st_base.median;
+		p = bench_mann_whitney(base[j].ns, base[j].reps, r->ns, r->reps);
+
+		if (p < BENCH_ALPHA && change > limit) {
+			verdict = "  REGRESSION";
+			regressions++;
+		} else if (p < BENCH_ALPHA && change < -limit) {
+			verdict = "  improved";
+			improvements++;
+		}
+
+		printf("%-16s %-8s %9.2f %9.2f %+7.1f%% %7.3f %7.1f%%%s\n",
+		       r->name, r->corpus, st_base.median, st_new.median, change, p, limit, verdict);
+
+	}
+
+	printf("\n%zu regression%s, %zu improvement%s\n",
+	       regressions, regressions == 1 ? "" : "s", improvements, improvements == 1 ? "" : "s");
+
+	return regressions == 0;
+
+}
+
+
+/*
+ *  Save or compare the results as requested, returning the exit status.
+ *
+ */
+static int bench_report(const struct bench_opts_s* const opts)
+{
+
+	if (opts->save_path) {
+		if (!bench_save(opts->save_path)) {
+			fprintf(stderr, "Unable to write %s\n", opts->save_path);
+			return EXIT_FAILURE;
+		}
+		printf("\nSaved %zu results to %s\n", results_num, opts->save_path);
+	}
+
+	if (opts->baseline_path && !bench_compare(opts, opts->baseline_path))
+		return EXIT_FAILURE;
+
+	return EXIT_SUCCESS;
+
+}
+
+
+static void usage(const char* const prog)
+{
+	fprintf(stderr, "Usage: %s [options] [linter ...]\n", prog);
+	fprintf(stderr, "       %s -d gs1-syntax-dictionary.txt -e labels.txt [options]\n", prog);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "  -r reps     Measured repetitions per corpus (default 11, max %d)\n", BENCH_MAX_REPS);
+	fprintf(stderr, "  -w warmups  Discarded repetitions per corpus (default 2)\n");
+	fprintf(stderr, "  -t ms       Target time per repetition (default 20)\n");
+	fprintf(stderr, "  -c cpu      CPU to pin to (default: the current CPU)\n");
+	fprintf(stderr, "  -d file     Syntax Dictionary for the end-to-end benchmark\n");
+	fprintf(stderr, "  -e file     Element strings for the end-to-end benchmark, one per line\n");
+	fprintf(stderr, "  -o file     Save the results as a JSON baseline\n");
+	fprintf(stderr, "  -b file     Compare the results with a JSON baseline\n");
+	fprintf(stderr, "  -T [linter=]pct\n");
+	fprintf(stderr, "              Slowdown over the baseline reported as a regression, for all\n");
+	fprintf(stderr, "              linters or for the given linter (default 5)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+
+	struct bench_opts_s opts = { 11, 2, 20e6, -1, NULL, 0, NULL, NULL, 5, { { NULL, 0 } }, 0 };
+	const char *dict_path = NULL, *labels_path = NULL;
+	size_t i;
+	int a;
+	bool ok = true;
+
+	for (a = 1; a < argc && argv[a][0] == '-'; a++) {
+		const char opt = argv[a][1];
+		char *arg;
+		long v;
+		if (opt == '\0' || argv[a][2] != '\0' || a + 1 == argc) {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		arg = argv[++a];
+		v = strtol(arg, NULL, 10);
+		switch (opt) {
+		case 'd':
+			dict_path = arg;
+			break;
+		case 'e':
+			labels_path = arg;
+			break;
+		case 'r':
+			if (v < 1 || v > BENCH_MAX_REPS) { usage(argv[0]); return EXIT_FAILURE; }
+			opts.reps = (unsigned int)v;
+			break;
+		case 'w':
+			if (v < 0 || v > 1000) { usage(argv[0]); return EXIT_FAILURE; }
+			opts.warmups = (unsigned int)v;
+			break;
+		case 't':
+			if (v < 1 || v > 60000) { usage(argv[0]); return EXIT_FAILURE; }
+			opts.target_ns = (double)v * 1e6;
+			break;
+		case 'c':
+			opts.cpu = (int)v;
+			break;
+		case 'o':
+			opts.save_path = arg;
+			break;
+		case 'b':
+			opts.baseline_path = arg;
+			break;
+		case 'T': {
+			char *eq = strchr(arg, '=');
+			char *end;
+			const double pct = strtod(eq ? eq + 1 : arg, &end);
+			if (*end != '\0' || end == (eq ? eq + 1 : arg) || pct < 0 ||
+			    (eq && (eq == arg || opts.thresholds_num == BENCH_MAX_THRESHOLDS))) {
+				usage(argv[0]);
+				return EXIT_FAILURE;
+			}
+			if (!eq) {
+				opts.threshold = pct;
+				break;
+			}
+			*eq = '\0';
+			if (!gs1_linter_from_name(arg) && strcmp(arg, "end-to-end") != 0) {
+				fprintf(stderr, "%s: No such linter\n", arg);
+				return EXIT_FAILURE;
+			}
+			opts.thresholds[opts.thresholds_num].name = arg;
+			opts.thresholds[opts.thresholds_num++].percent = pct;
+			break;
+		}
+		default:
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	opts.only = &argv[a];
+	opts.only_num = argc - a;
+
+	if (dict_path || labels_path) {
+
+		struct bench_labels_s labels;
+		gs1_dict_t *dict;
+		size_t err_line;
+
+		if (!dict_path || !labels_path || opts.only_num) {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		if (!(dict = gs1_dict_load_file(dict_path, &err_line))) {
+			fprintf(stderr, "Unable to load %s (line %zu)\n", dict_path, err_line);
+			return EXIT_FAILURE;
+		}
+		if (!bench_load_labels(labels_path, &labels)) {
+			fprintf(stderr, "Unable to load element strings from %s\n", labels_path);
+			return EXIT_FAILURE;
+		}
+
+		bench_pin(opts.cpu);
+		bench_cycles_init();
+
+		printf("Repetitions: %u; warm-up: %u; target: %.0f ms; cycles: %s\n",
+		       opts.reps, opts.warmups, opts.target_ns / 1e6, cycles_source);
+		printf("Syntax Dictionary release: %s\n", gs1_dict_release(dict));
+		bench_e2e(&opts, dict, &labels);
+
+		free(labels.labels);
+		free(labels.buf);
+		gs1_dict_free(dict);
+		return bench_report(&opts);
+
+	}
+
+	/*
+	 *  Every linter must have a corpus, and every corpus must be correct.
+	 *
+	 */
+	for (i = 0; i < name_function_map_len; i++) {
+		const struct bench_corpus_s *c = bench_find_corpus(gs1_lint_name(i));
+		if (!c) {
+			fprintf(stderr, "%s: No benchmark corpus\n", gs1_lint_name(i));
+			ok = false;
+			continue;
+		}
+		ok = bench_check_corpus(c, name_function_map[i].fn) && ok;
+	}
+	for (a = 0; a < opts.only_num; a++) {
+		if (!gs1_linter_from_name(opts.only[a])) {
+			fprintf(stderr, "%s: No such linter\n", opts.only[a]);
+			ok = false;
+		}
+	}
+	if (!ok)
+		return EXIT_FAILURE;
+
+	bench_pin(opts.cpu);
+	bench_cycles_init();
+
+	printf("Repetitions: %u; warm-up: %u; target: %.0f ms; cycles: %s\n\n",
+	       opts.reps, opts.warmups, opts.target_ns / 1e6, cycles_source);
+	printf("%-16s %-8s %5s %9s %7s %9s %10s %10s\n",
+	       "linter", "corpus", "len", "ns/op", "rsd", "min", "MB/s", "cycles/op");
+
+	for (i = 0; i < name_function_map_len; i++) {
+		const struct bench_corpus_s *c = bench_find_corpus(gs1_lint_name(i));
+		if (!bench_selected(&opts, c->name))
+			continue;
+		bench_corpus(&opts, c->name, name_function_map[i].fn, "valid", c->valid);
+		bench_corpus(&opts, c->name, name_function_map[i].fn, "invalid", c->invalid);
+	}
+
+	return bench_report(&opts);
+
+}
@@ -0,0 +1,79 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Helpers shared by the benchmark tools. Not part of the library.
+ *
+ */
+
+#ifndef GS1_SYNTAXDICTIONARY_BENCH_H
+#define GS1_SYNTAXDICTIONARY_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gs1syntaxdictionary.h"
+
+
+/*
+ *  Character used to represent FNC1 in element strings.
+ *
+ */
+#define BENCH_FNC1 '^'
+
+
+/*
+ *  The linter that enforces the character set of a component.
+ *
+ */
+static inline gs1_linter_t bench_cset_linter(const char cset)
+{
+	switch (cset) {
+	case 'N': return gs1_lint_csetnumeric;
+	case 'Y': return gs1_lint_cset39;
+	case 'Z': return gs1_lint_cset64;
+	default:  return gs1_lint_cset82;
+	}
+}
+
+
+/*
+ *  Validate the data for a component against its length, character set and
+ *  linters, stopping at the first failure as a framework would.
+ *
+ */
+static inline bool bench_lint_component(const gs1_dict_component_t* const c, const char* const data, const size_t len)
+{
+
+	unsigned int i;
+
+	if (len < c->min || len > c->max)
+		return false;
+
+	if (bench_cset_linter(c->cset)(data, len, NULL, NULL) != GS1_LINTER_OK)
+		return false;
+
+	for (i = 0; i < c->num_linters; i++)
+		if (c->linters[i](data, len, NULL, NULL) != GS1_LINTER_OK)
+			return false;
+
+	return true;
+
+}
+
+#endif  /* GS1_SYNTAXDICTIONARY_BENCH_H */
@@ -0,0 +1,154 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-bulk.c
+ *
+ * @brief Application of a linter to many values in a single call.
+ *
+ * Intended for bindings where each call into the library is costly, such as
+ * JavaScript calling the WebAssembly build (see "make wasm"). The caller
+ * packs the values back to back into one buffer and describes them with an
+ * array of offsets, so that an entire column of a spreadsheet can be linted
+ * with one call and the results read back from typed arrays.
+ *
+ * When no error positions are requested, each value is first checked by the
+ * validity-only variant of a character set linter, which examines several
+ * characters at a time, and the linter itself runs only for a value that
+ * fails, to determine the error.
+ *
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/**
+ * Apply a linter to each of a number of values held in a packed buffer.
+ *
+ * Value `i` is the `offsets[i+1] - offsets[i]` bytes of `data` starting at
+ * `offsets[i]`.
+ *
+ * @param [in] linter The linter to apply, e.g. from gs1_linter_from_name().
+ *                    Must not be `NULL`.
+ * @param [in] data The values, back to back. May be `NULL` only if every
+ *                  value is empty.
+ * @param [in] offsets Array of `count + 1` non-decreasing offsets into
+ *                     `data`.
+ * @param [in] count Number of values.
+ * @param [out] errs Array of `count` entries to receive the result of the
+ *                   linter for each value.
+ * @param [out] err_pos If not `NULL`, array of `count` entries to receive the
+ *                      start of the bad data, relative to the start of each
+ *                      value, or 0 if the value is valid.
+ * @param [out] err_len If not `NULL`, array of `count` entries to receive the
+ *                      length of the bad data, or 0 if the value is valid.
+ *
+ * @return the number of values for which the linter did not return
+ *         #GS1_LINTER_OK
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_bulk(const gs1_linter_t linter, const char* const data, const uint32_t* const offsets, const size_t count, gs1_lint_err_t* const errs, uint32_t* const err_pos, uint32_t* const err_len)
+{
+
+	const gs1_lint_valid_fn_t valid = !err_pos && !err_len ? gs1_lint_valid_variant(linter) : NULL;
+	size_t i, failed = 0;
+
+	assert(linter);
+	assert(offsets);
+	assert(errs || count == 0);
+
+	for (i = 0; i < count; i++) {
+
+		const uint32_t start = offsets[i];
+		const size_t len = offsets[i + 1] - start;
+		const char* const value = len ? data + start : "";
+		size_t pos = 0, plen = 0;
+
+		assert(offsets[i + 1] >= start);
+		assert(data || len == 0);
+
+		if (valid && valid(value, len))
+			errs[i] = GS1_LINTER_OK;
+		else
+			errs[i] = linter(value, len, &pos, &plen);
+		if (errs[i] != GS1_LINTER_OK)
+			failed++;
+		else
+			pos = plen = 0;
+
+		if (err_pos)
+			err_pos[i] = (uint32_t)pos;
+		if (err_len)
+			err_len[i] = (uint32_t)plen;
+
+	}
+
+	return failed;
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+void test_gs1_lint_bulk(void)
+{
+
+	static const char data[] = "12345" "" "12A45" "9" "00000000";
+	static const uint32_t offsets[] = { 0, 5, 5, 10, 11, 19 };
+	gs1_lint_err_t errs[5];
+	uint32_t err_pos[5], err_len[5];
+
+	TEST_CHECK(gs1_lint_bulk(gs1_lint_csetnumeric, data, offsets, 5, errs, err_pos, err_len) == 1);
+	TEST_CHECK(errs[0] == GS1_LINTER_OK);
+	TEST_CHECK(errs[1] == GS1_LINTER_OK);
+	TEST_CHECK(errs[2] == GS1_LINTER_NON_DIGIT_CHARACTER);
+	TEST_CHECK(err_pos[2] == 2 && err_len[2] == 1);
+	TEST_CHECK(errs[3] == GS1_LINTER_OK && err_pos[3] == 0 && err_len[3] == 0);
+	TEST_CHECK(errs[4] == GS1_LINTER_OK);
+
+	TEST_CHECK(gs1_lint_bulk(gs1_lint_nonzero, data, offsets, 5, errs, NULL, NULL) == 3);
+	TEST_CHECK(errs[1] == GS1_LINTER_ILLEGAL_ZERO_VALUE);
+	TEST_CHECK(errs[2] == GS1_LINTER_NON_DIGIT_CHARACTER);
+	TEST_CHECK(errs[4] == GS1_LINTER_ILLEGAL_ZERO_VALUE);
+
+	/*
+	 *  Without error positions, using the validity-only variant.
+	 *
+	 */
+	TEST_CHECK(gs1_lint_bulk(gs1_lint_csetnumeric, data, offsets, 5, errs, NULL, NULL) == 1);
+	TEST_CHECK(errs[0] == GS1_LINTER_OK);
+	TEST_CHECK(errs[1] == GS1_LINTER_OK);
+	TEST_CHECK(errs[2] == GS1_LINTER_NON_DIGIT_CHARACTER);
+	TEST_CHECK(errs[4] == GS1_LINTER_OK);
+
+	TEST_CHECK(gs1_lint_bulk(gs1_lint_csetnumeric, data, offsets, 5, errs, err_pos, NULL) == 1);
+	TEST_CHECK(errs[2] == GS1_LINTER_NON_DIGIT_CHARACTER && err_pos[2] == 2);
+
+	TEST_CHECK(gs1_lint_bulk(gs1_lint_csetnumeric, NULL, offsets, 0, NULL, NULL, NULL) == 0);
+
+}
+
+#endif  /* UNIT_TESTS */
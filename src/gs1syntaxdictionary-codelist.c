@@ -0,0 +1,446 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-codelist.c
+ *
+ * @brief Runtime replacement of the code lists that are compiled into the
+ * reference linters.
+ *
+ * The ISO 3166, ISO 4217, AIDC media type and PackageTypeCode lists change
+ * more often than applications are rebuilt. A long-running application may
+ * load an updated list at any time and subsequent linting uses the new list
+ * without a restart.
+ *
+ * A loaded list is held as a bit field over the domain of possible codes, so
+ * that lookups remain a single bit test. Replacement is lock free for the
+ * linters: the new table is published with an atomic pointer swap and the old
+ * table is freed once no linter can still be reading it (see
+ * gs1syntaxdictionary-epoch.c).
+ *
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+#define GS1_LINTER_CODELIST_MAX_FILE_SIZE (1024 * 1024)
+
+
+/*
+ * Number of runtime-loaded lists currently in place, which allows linters to
+ * skip the runtime lookup entirely in the common case that none are loaded.
+ *
+ */
+GS1_LINTER_INTERNAL volatile long gs1_lint_codelists_active = 0;
+
+static gs1_lint_codelist_table_t * volatile codelists[__GS1_LINTER_CODELIST_NUM];
+
+
+/*
+ * Alphanumeric characters of the PackageTypeCode alphabet mapped to 0-35.
+ *
+ */
+static int an_index(const char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'A' && c <= 'Z')
+		return c - 'A' + 10;
+	return -1;
+}
+
+
+/*
+ * Size of the domain of possible codes for each list.
+ *
+ */
+static size_t codelist_domain(const gs1_lint_codelist_t list)
+{
+	static const size_t domain[__GS1_LINTER_CODELIST_NUM] = {
+		[GS1_LINTER_CODELIST_ISO3166] = 1000,
+		[GS1_LINTER_CODELIST_ISO3166ALPHA2] = 26 * 26,
+		[GS1_LINTER_CODELIST_ISO4217] = 1000,
+		[GS1_LINTER_CODELIST_MEDIA_TYPE] = 100,
+		[GS1_LINTER_CODELIST_PACKAGE_TYPE] = 36 + 36 * 36 + 36 * 36 * 36,
+	};
+	return domain[list];
+}
+
+
+/*
+ * Position of a code within the domain of its list, or -1 if the data is not
+ * in the format of a code for the list.
+ *
+ */
+static long codelist_index(const gs1_lint_codelist_t list, const char* const data, const size_t data_len)
+{
+
+	long idx = 0;
+	size_t i;
+
+	switch (list) {
+
+	case GS1_LINTER_CODELIST_ISO3166:
+	case GS1_LINTER_CODELIST_ISO4217:
+	case GS1_LINTER_CODELIST_MEDIA_TYPE:
+		if (data_len != (list == GS1_LINTER_CODELIST_MEDIA_TYPE ? 2 : 3))
+			return -1;
+		for (i = 0; i < data_len; i++) {
+			if (data[i] < '0' || data[i] > '9')
+				return -1;
+			idx = idx * 10 + data[i] - '0';
+		}
+		return idx;
+
+	case GS1_LINTER_CODELIST_ISO3166ALPHA2:
+		if (data_len != 2 || data[0] < 'A' || data[0] > 'Z' || data[1] < 'A' || data[1] > 'Z')
+			return -1;
+		return (data[0] - 'A') * 26 + data[1] - 'A';
+
+	case GS1_LINTER_CODELIST_PACKAGE_TYPE:
+	default:
+		/*
+		 * Codes of one, two and three characters occupy consecutive
+		 * ranges of the domain.
+		 *
+		 */
+		if (data_len < 1 || data_len > 3)
+			return -1;
+		for (i = 0; i < data_len; i++) {
+			const int c = an_index(data[i]);
+			if (c < 0)
+				return -1;
+			idx = idx * 36 + c;
+		}
+		return idx + (data_len >= 2 ? 36 : 0) + (data_len == 3 ? 36 * 36 : 0);
+
+	}
+
+}
+
+
+/*
+ * Publish a table for a list, wait for any readers of the replaced table to
+ * finish and then release it.
+ *
+ */
+static void codelist_publish(const gs1_lint_codelist_t list, gs1_lint_codelist_table_t* const table)
+{
+
+	gs1_lint_codelist_table_t *old;
+
+	old = (gs1_lint_codelist_table_t *)GS1_LINTER_ATOMIC_XCHG_PTR(&codelists[list], table);
+
+	if (!old && table)
+		GS1_LINTER_ATOMIC_ADD(&gs1_lint_codelists_active, 1);
+	else if (old && !table)
+		GS1_LINTER_ATOMIC_ADD(&gs1_lint_codelists_active, -1);
+
+	if (!old)
+		return;
+
+	gs1_lint_epoch_synchronize();
+	free(old);
+
+}
+
+
+/**
+ * Replace a compiled-in code list with a list of codes provided at runtime.
+ *
+ * The codes are separated by whitespace or commas. Text from `#` to the end
+ * of a line is a comment. Each code must be in the format required by the
+ * list, for example three digits for #GS1_LINTER_CODELIST_ISO3166.
+ *
+ * The replacement takes effect atomically: a concurrently executing linter
+ * sees either the previous list or the new one, never a mixture. Linters are
+ * not blocked while the list is replaced.
+ *
+ * If the linter has been built with a custom lookup macro (e.g.
+ * `GS1_LINTER_CUSTOM_ISO3166_LOOKUP`) then that takes precedence and the
+ * runtime list is not consulted.
+ *
+ * @param [in] list The code list to replace.
+ * @param [in] data Pointer to the list data. Must not be `NULL`.
+ * @param [in] data_len Length of the list data.
+ *
+ * @return `true` if the list was replaced.
+ * @return `false` if the data contains no codes, contains an invalid code or
+ *         memory could not be allocated, in which case the list in use is
+ *         unchanged.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_codelist_load(const gs1_lint_codelist_t list, const char* const data, const size_t data_len)
+{
+
+	gs1_lint_codelist_table_t *table;
+	size_t words, pos = 0, count = 0;
+
+	assert(list < __GS1_LINTER_CODELIST_NUM);
+	assert(data);
+
+	words = (codelist_domain(list) + 63) / 64;
+	table = (gs1_lint_codelist_table_t *)calloc(1, sizeof(gs1_lint_codelist_table_t) + words * sizeof(uint64_t));
+	if (GS1_LINTER_UNLIKELY(!table)) return false;
+	table->words = words;
+
+	while (pos < data_len) {
+
+		size_t start;
+		long idx;
+
+		if (data[pos] == '#') {
+			while (pos < data_len && data[pos] != '\n')
+				pos++;
+			continue;
+		}
+
+		if (isspace((unsigned char)data[pos]) || data[pos] == ',') {
+			pos++;
+			continue;
+		}
+
+		start = pos;
+		while (pos < data_len && !isspace((unsigned char)data[pos]) && data[pos] != ',' && data[pos] != '#')
+			pos++;
+
+		idx = codelist_index(list, &data[start], pos - start);
+		if (idx < 0 || (size_t)idx / 64 >= words) {
+			free(table);
+			return false;
+		}
+
+		table->bits[idx / 64] |= UINT64_C(1) << (63 - idx % 64);
+		count++;
+
+	}
+
+	if (count == 0) {
+		free(table);
+		return false;
+	}
+
+	codelist_publish(list, table);
+
+	return true;
+
+}
+
+
+/**
+ * Replace a compiled-in code list with a list of codes read from a file.
+ *
+ * The file format is as described for gs1_lint_codelist_load().
+ *
+ * @param [in] list The code list to replace.
+ * @param [in] path Path to the file. Must not be `NULL`.
+ *
+ * @return `true` if the list was replaced.
+ * @return `false` if the file could not be read or its contents are not a
+ *         valid list, in which case the list in use is unchanged.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_codelist_load_file(const gs1_lint_codelist_t list, const char* const path)
+{
+
+	char *buf;
+	size_t len;
+	bool ret;
+
+	assert(path);
+
+	buf = gs1_lint_read_file(path, GS1_LINTER_CODELIST_MAX_FILE_SIZE, &len);
+	if (!buf)
+		return false;
+
+	ret = gs1_lint_codelist_load(list, buf, len);
+	free(buf);
+
+	return ret;
+
+}
+
+
+/**
+ * Revert to the compiled-in code list, releasing any runtime-loaded list.
+ *
+ * @param [in] list The code list to reset.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_lint_codelist_reset(const gs1_lint_codelist_t list)
+{
+	assert(list < __GS1_LINTER_CODELIST_NUM);
+	codelist_publish(list, NULL);
+}
+
+
+/*
+ * Look up data in a runtime-loaded list, if one is active.
+ *
+ * Returns non-zero and sets `valid` if a runtime list is in place. Otherwise
+ * returns zero so that the linter falls back to its compiled-in list.
+ *
+ */
+GS1_LINTER_INTERNAL int gs1_lint_codelist_lookup(const gs1_lint_codelist_t list, const char* const data, const size_t data_len, int* const valid)
+{
+
+	gs1_lint_epoch_guard_t guard;
+	const gs1_lint_codelist_table_t *table;
+
+	gs1_lint_epoch_enter(&guard);
+
+	table = (const gs1_lint_codelist_table_t *)GS1_LINTER_ATOMIC_LOAD_PTR(&codelists[list]);
+	if (table) {
+		const long idx = codelist_index(list, data, data_len);
+		*valid = idx >= 0 && (size_t)idx / 64 < table->words &&
+			 (table->bits[idx / 64] & (UINT64_C(1) << (63 - idx % 64))) != 0;
+	}
+
+	gs1_lint_epoch_exit(&guard);
+
+	return table != NULL;
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#include <stdio.h>
+
+#include "unittest.h"
+
+void test_gs1_lint_codelist(void)
+{
+
+	static const char *file = "test-codelist.tmp";
+	FILE *fp;
+
+	/*
+	 * Invalid lists are rejected and the compiled-in list remains.
+	 *
+	 */
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "", 0));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "# Empty\n", 8));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "004 08", 6));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "004 0A8", 7));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166ALPHA2, "GB,Fr", 5));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_MEDIA_TYPE, "001", 3));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_PACKAGE_TYPE, "AAAA", 4));
+	TEST_CHECK(!gs1_lint_codelist_load(GS1_LINTER_CODELIST_PACKAGE_TYPE, "A-", 2));
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) == 0);
+	UNIT_TEST_PASS(gs1_lint_iso3166, "004");
+	UNIT_TEST_FAIL(gs1_lint_iso3166, "999", GS1_LINTER_NOT_ISO3166, "*999*");
+
+	/*
+	 * A loaded list replaces the compiled-in list, including for linters
+	 * that use it indirectly.
+	 *
+	 */
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "# New list\n999, 004 #Old\r\n000", 29));
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) == 1);
+	UNIT_TEST_PASS(gs1_lint_iso3166, "999");
+	UNIT_TEST_PASS(gs1_lint_iso3166, "004");
+	UNIT_TEST_PASS(gs1_lint_iso3166, "000");
+	UNIT_TEST_FAIL(gs1_lint_iso3166, "008", GS1_LINTER_NOT_ISO3166, "*008*");
+	UNIT_TEST_FAIL(gs1_lint_iso3166, "99", GS1_LINTER_NOT_ISO3166, "*99*");
+	UNIT_TEST_PASS(gs1_lint_iso3166999, "000");
+	UNIT_TEST_FAIL(gs1_lint_iso4217, "000", GS1_LINTER_NOT_ISO4217, "*000*");	// Other lists unaffected
+
+	/*
+	 * Replacing a loaded list.
+	 *
+	 */
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166, "008", 3));
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) == 1);
+	UNIT_TEST_PASS(gs1_lint_iso3166, "008");
+	UNIT_TEST_FAIL(gs1_lint_iso3166, "004", GS1_LINTER_NOT_ISO3166, "*004*");
+
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO3166ALPHA2, "ZZ", 2));
+	UNIT_TEST_PASS(gs1_lint_iso3166alpha2, "ZZ");
+	UNIT_TEST_FAIL(gs1_lint_iso3166alpha2, "GB", GS1_LINTER_NOT_ISO3166_ALPHA2, "*GB*");
+	UNIT_TEST_FAIL(gs1_lint_iso3166alpha2, "Z1", GS1_LINTER_NOT_ISO3166_ALPHA2, "*Z1*");
+	UNIT_TEST_FAIL(gs1_lint_iso3166alpha2, "\xC9Z", GS1_LINTER_NOT_ISO3166_ALPHA2, "*\xC9Z*");
+
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_ISO4217, "000", 3));
+	UNIT_TEST_PASS(gs1_lint_iso4217, "000");
+	UNIT_TEST_FAIL(gs1_lint_iso4217, "978", GS1_LINTER_NOT_ISO4217, "*978*");
+
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_MEDIA_TYPE, "00 99", 5));
+	UNIT_TEST_PASS(gs1_lint_mediatype, "00");
+	UNIT_TEST_PASS(gs1_lint_mediatype, "99");
+	UNIT_TEST_FAIL(gs1_lint_mediatype, "01", GS1_LINTER_INVALID_MEDIA_TYPE, "*01*");
+
+	TEST_CHECK(gs1_lint_codelist_load(GS1_LINTER_CODELIST_PACKAGE_TYPE, "0 Z 00 ZZ 000 ZZZ", 17));
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) == 5);
+	UNIT_TEST_PASS(gs1_lint_packagetype, "0");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "Z");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "00");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "ZZ");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "000");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "ZZZ");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "1A", GS1_LINTER_INVALID_PACKAGE_TYPE, "*1A*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "", GS1_LINTER_INVALID_PACKAGE_TYPE, "**");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "ZZZZ", GS1_LINTER_INVALID_PACKAGE_TYPE, "*ZZZZ*");
+
+	/*
+	 * Loading from a file.
+	 *
+	 */
+	TEST_CHECK(!gs1_lint_codelist_load_file(GS1_LINTER_CODELIST_MEDIA_TYPE, "test-codelist-missing.tmp"));
+	fp = fopen(file, "wb");
+	TEST_ASSERT(fp != NULL);
+	fputs("# Media types\n01\n02\n", fp);
+	fclose(fp);
+	TEST_CHECK(gs1_lint_codelist_load_file(GS1_LINTER_CODELIST_MEDIA_TYPE, file));
+	UNIT_TEST_PASS(gs1_lint_mediatype, "01");
+	UNIT_TEST_FAIL(gs1_lint_mediatype, "00", GS1_LINTER_INVALID_MEDIA_TYPE, "*00*");
+	TEST_CHECK(!gs1_lint_codelist_load_file(GS1_LINTER_CODELIST_ISO3166, file));
+	fp = fopen(file, "wb");
+	TEST_ASSERT(fp != NULL);
+	fseek(fp, GS1_LINTER_CODELIST_MAX_FILE_SIZE, SEEK_SET);
+	fputc('\n', fp);
+	fclose(fp);
+	TEST_CHECK(!gs1_lint_codelist_load_file(GS1_LINTER_CODELIST_MEDIA_TYPE, file));	// Too large
+	remove(file);
+
+	/*
+	 * Reset reverts to the compiled-in lists.
+	 *
+	 */
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_ISO3166);
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_ISO3166);
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_ISO3166ALPHA2);
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_ISO4217);
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_MEDIA_TYPE);
+	gs1_lint_codelist_reset(GS1_LINTER_CODELIST_PACKAGE_TYPE);
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) == 0);
+	UNIT_TEST_PASS(gs1_lint_iso3166, "004");
+	UNIT_TEST_FAIL(gs1_lint_iso3166, "999", GS1_LINTER_NOT_ISO3166, "*999*");
+	UNIT_TEST_PASS(gs1_lint_packagetype, "1A");
+
+}
+
+#endif  /* UNIT_TESTS */
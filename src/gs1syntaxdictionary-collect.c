@@ -0,0 +1,246 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-collect.c
+ *
+ * @brief Reporting of every problem with a value, rather than only the first.
+ *
+ * Each linter stops at the first error that it finds. To highlight every
+ * problem with a value at once, e.g. all of the invalid characters together
+ * with an incorrect date, gs1_lint_collect() applies a list of linters and
+ * records the findings of each. The character set linters are resumed just
+ * beyond each invalid character, so that the data is traversed only once
+ * however many invalid characters it contains.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ *  Linters whose errors each concern a single character, independently of
+ *  the rest of the data, so that linting can resume after a reported error.
+ *
+ */
+static bool collect_resumable(const gs1_linter_t linter)
+{
+	return linter == gs1_lint_csetnumeric ||
+	       linter == gs1_lint_cset39 ||
+	       linter == gs1_lint_cset64 ||
+	       linter == gs1_lint_cset82;
+}
+
+
+/*
+ *  Record a finding unless an earlier linter has already reported the same
+ *  problem, e.g. a non-digit character found by both csetnumeric and csum.
+ *
+ *  Only the findings of the earlier linters, those before `first`, are
+ *  compared, since a resumed linter never reports the same position twice.
+ *  This keeps the cost linear in the number of findings for a single
+ *  character set linter.
+ *
+ */
+static size_t collect_add(gs1_lint_finding_t* const findings, const size_t first, const size_t num, const gs1_lint_err_t err, const size_t err_pos, const size_t err_len)
+{
+
+	size_t i;
+
+	for (i = 0; i < first; i++)
+		if (findings[i].err == err && findings[i].err_pos == err_pos && findings[i].err_len == err_len)
+			return num;
+
+	findings[num].err = err;
+	findings[num].err_pos = err_pos;
+	findings[num].err_len = err_len;
+
+	return num + 1;
+
+}
+
+
+/**
+ * Apply each of a list of linters to some data, recording every problem that
+ * is found rather than only the first.
+ *
+ * The character set linters (csetnumeric, cset39, cset64 and cset82) report
+ * every invalid character. Any other linter reports at most its first error,
+ * since the data beyond it often cannot be interpreted, e.g. there is no check
+ * digit to verify once a non-digit character has been found. A finding that
+ * repeats one already recorded by an earlier linter is omitted.
+ *
+ * @param [in] linters The linters to apply, in order, e.g. the character set
+ *                     linter for a component followed by its other linters.
+ * @param [in] num_linters Number of linters.
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] findings Array of `capacity` entries to receive the findings,
+ *                       ordered by linter and then by position. May be `NULL`
+ *                       only if `capacity` is 0.
+ * @param [in] capacity Maximum number of findings to record.
+ *
+ * @return the number of findings recorded, which is 0 if the data is valid. If
+ *         this is `capacity` then further findings may have been omitted.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_collect(const gs1_linter_t* const linters, const size_t num_linters, const char* const data, const size_t data_len, gs1_lint_finding_t* const findings, const size_t capacity)
+{
+
+	size_t i, num = 0;
+
+	assert(linters || num_linters == 0);
+	assert(data);
+	assert(findings || capacity == 0);
+
+	for (i = 0; i < num_linters && num < capacity; i++) {
+
+		const gs1_linter_t linter = linters[i];
+		const size_t first = num;
+		size_t off = 0, end = data_len, pos = 0, len = 0;
+		gs1_lint_err_t ret;
+
+		assert(linter);
+
+		/*
+		 *  The padding of CSET 64 data is checked by the first pass over
+		 *  the whole of the data, after which only the characters
+		 *  preceding the padding remain to be checked.
+		 *
+		 */
+		if (linter == gs1_lint_cset64)
+			while (end > 0 && data[end - 1] == '=')
+				end--;
+
+		ret = linter(data, data_len, &pos, &len);
+		while (ret != GS1_LINTER_OK) {
+
+			num = collect_add(findings, first, num, ret, off + pos, len);
+			if (!collect_resumable(linter) || num == capacity)
+				break;
+
+			if (ret != GS1_LINTER_INVALID_CSET64_PADDING)
+				off += pos + len;
+			if (off >= end)
+				break;
+
+			ret = linter(data + off, end - off, &pos, &len);
+
+		}
+
+	}
+
+	return num;
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#include <string.h>
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+static size_t test_collect(const gs1_linter_t* const linters, const size_t num_linters, const char* const data, gs1_lint_finding_t* const findings, const size_t capacity)
+{
+	return gs1_lint_collect(linters, num_linters, data, strlen(data), findings, capacity);
+}
+
+#define TEST_FINDING(f, e, p, l) TEST_CHECK((f).err == (e) && (f).err_pos == (p) && (f).err_len == (l))
+
+void test_gs1_lint_collect(void)
+{
+
+	static const gs1_linter_t cset82[] = { gs1_lint_cset82 };
+	static const gs1_linter_t cset64[] = { gs1_lint_cset64 };
+	static const gs1_linter_t gtin[] = { gs1_lint_csetnumeric, gs1_lint_csum };
+	static const gs1_linter_t date[] = { gs1_lint_csetnumeric, gs1_lint_yymmdd };
+	static const gs1_linter_t serial[] = { gs1_lint_cset39, gs1_lint_nozeroprefix };
+	gs1_lint_finding_t f[8];
+
+	TEST_CHECK(test_collect(cset82, 1, "ABC123", f, 8) == 0);
+	TEST_CHECK(test_collect(cset82, 1, "", f, 8) == 0);
+	TEST_CHECK(test_collect(cset82, 0, "A B", f, 8) == 0);
+	TEST_CHECK(test_collect(cset82, 1, "A B", NULL, 0) == 0);
+
+	/*
+	 *  Every invalid character is reported, including adjacent ones and
+	 *  those at either end.
+	 *
+	 */
+	TEST_ASSERT(test_collect(cset82, 1, " A#$B ", f, 8) == 4);
+	TEST_FINDING(f[0], GS1_LINTER_INVALID_CSET82_CHARACTER, 0, 1);
+	TEST_FINDING(f[1], GS1_LINTER_INVALID_CSET82_CHARACTER, 2, 1);
+	TEST_FINDING(f[2], GS1_LINTER_INVALID_CSET82_CHARACTER, 3, 1);
+	TEST_FINDING(f[3], GS1_LINTER_INVALID_CSET82_CHARACTER, 5, 1);
+
+	TEST_CHECK(test_collect(cset82, 1, " A#$B ", f, 2) == 2);
+	TEST_FINDING(f[1], GS1_LINTER_INVALID_CSET82_CHARACTER, 2, 1);
+
+	/*
+	 *  Invalid characters and invalid padding.
+	 *
+	 */
+	TEST_ASSERT(test_collect(cset64, 1, "A+B+==", f, 8) == 2);
+	TEST_FINDING(f[0], GS1_LINTER_INVALID_CSET64_CHARACTER, 1, 1);
+	TEST_FINDING(f[1], GS1_LINTER_INVALID_CSET64_CHARACTER, 3, 1);
+
+	TEST_ASSERT(test_collect(cset64, 1, "A+B===", f, 8) == 2);
+	TEST_FINDING(f[0], GS1_LINTER_INVALID_CSET64_PADDING, 3, 3);
+	TEST_FINDING(f[1], GS1_LINTER_INVALID_CSET64_CHARACTER, 1, 1);
+
+	TEST_ASSERT(test_collect(cset64, 1, "AB+===", f, 8) == 2);
+	TEST_FINDING(f[1], GS1_LINTER_INVALID_CSET64_CHARACTER, 2, 1);
+
+	TEST_ASSERT(test_collect(cset64, 1, "====", f, 8) == 1);
+	TEST_FINDING(f[0], GS1_LINTER_INVALID_CSET64_PADDING, 0, 4);
+
+	/*
+	 *  The non-digit reported again by csum is omitted.
+	 *
+	 */
+	TEST_ASSERT(test_collect(gtin, 2, "0950A10153B009", f, 8) == 2);
+	TEST_FINDING(f[0], GS1_LINTER_NON_DIGIT_CHARACTER, 4, 1);
+	TEST_FINDING(f[1], GS1_LINTER_NON_DIGIT_CHARACTER, 10, 1);
+
+	TEST_ASSERT(test_collect(gtin, 2, "09501101530009", f, 8) == 1);
+	TEST_FINDING(f[0], GS1_LINTER_INCORRECT_CHECK_DIGIT, 13, 1);
+
+	TEST_ASSERT(test_collect(date, 2, "261332", f, 8) == 1);
+	TEST_CHECK(f[0].err == GS1_LINTER_ILLEGAL_MONTH);
+
+	/*
+	 *  Findings from several linters.
+	 *
+	 */
+	TEST_ASSERT(test_collect(serial, 2, "0A-B_C#", f, 8) == 2);
+	TEST_FINDING(f[0], GS1_LINTER_INVALID_CSET39_CHARACTER, 4, 1);
+	TEST_FINDING(f[1], GS1_LINTER_ILLEGAL_ZERO_PREFIX, 0, 1);
+
+}
+
+#undef TEST_FINDING
+
+#endif  /* UNIT_TESTS */
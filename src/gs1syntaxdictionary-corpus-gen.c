@@ -0,0 +1,455 @@
+/**
+ * GS1 Barcode Syntax Dictionary
+ *
+ * @author Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Generate a synthetic corpus of GS1 element strings for end-to-end
+ * benchmarking, one per line, with "^" representing FNC1.
+ *
+ * Usage:
+ *
+ *     gs1syntaxdictionary-corpus-gen -d gs1-syntax-dictionary.txt [-n count]
+ *         [-m profile=weight,...] [-e error_rate] [-s seed] > labels.txt
+ *
+ * Each label is drawn from a profile according to the given weights:
+ *
+ *   logistics   GS1-128 logistics labels: SSCC, content, count, dates, batch
+ *               and ship-to data.
+ *   healthcare  GS1 DataMatrix on healthcare items: GTIN, expiry, batch and
+ *               serial number.
+ *   coupon      North American coupons: AIs (8110) and (8112).
+ *
+ * The format of each AI is taken from the Syntax Dictionary, and values are
+ * generated at random subject to each component's length, character set and
+ * linters. AIs with predefined length are not followed by FNC1.
+ *
+ * With the given probability a label has a single character of one of its
+ * values substituted by another from the same character set. Not every such
+ * substitution is detectable, e.g. within a batch number.
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-bench.h"
+
+
+#define MAX_TEMPLATE_AIS 8
+#define MAX_LABEL 512
+#define MAX_ATTEMPTS 100000
+
+
+/*
+ *  Label templates for each profile. Each AI is included with the given
+ *  percentage probability.
+ *
+ */
+struct template_ai_s {
+	const char *ai;
+	unsigned int percent;
+};
+
+struct template_s {
+	struct template_ai_s ais[MAX_TEMPLATE_AIS];
+};
+
+static const struct template_s logistics[] = {
+	{ { { "00", 100 } } },
+	{ { { "00", 100 }, { "02", 100 }, { "37", 100 }, { "15", 40 }, { "10", 70 } } },
+	{ { { "02", 100 }, { "3102", 60 }, { "37", 100 }, { "17", 30 }, { "10", 50 } } },
+	{ { { "00", 100 }, { "410", 100 }, { "421", 60 }, { "400", 50 } } },
+	{ { { "00", 100 }, { "410", 100 }, { "420", 60 } } },
+};
+
+static const struct template_s healthcare[] = {
+	{ { { "01", 100 }, { "17", 100 }, { "10", 100 }, { "21", 90 } } },
+	{ { { "01", 100 }, { "11", 40 }, { "17", 100 }, { "10", 100 } } },
+	{ { { "01", 100 }, { "7003", 30 }, { "21", 100 }, { "10", 80 } } },
+	{ { { "01", 100 }, { "17", 100 }, { "30", 20 }, { "10", 100 } } },
+};
+
+static const struct template_s coupon[] = {
+	{ { { "8110", 100 } } },
+	{ { { "8112", 100 } } },
+};
+
+static const struct profile_s {
+	const char *name;
+	const struct template_s *templates;
+	size_t num_templates;
+} profiles[] = {
+	{ "logistics", logistics, sizeof(logistics) / sizeof(logistics[0]) },
+	{ "healthcare", healthcare, sizeof(healthcare) / sizeof(healthcare[0]) },
+	{ "coupon", coupon, sizeof(coupon) / sizeof(coupon[0]) },
+};
+
+#define NUM_PROFILES (sizeof(profiles) / sizeof(profiles[0]))
+
+
+/*
+ *  Some linters are impractical to satisfy with random data, so draw from a
+ *  pool of known-good values.
+ *
+ */
+static const char *couponcode_pool[] = {
+	"106141411234562891101201212085010048000214025610048000310123191000",
+	"1061414154321031501101201211014092110256100126663101231",
+	"106141416543213500110000310123196000",
+};
+
+static const char *couponposoffer_pool[] = {
+	"061234567890121234569123456789012345",
+	"001234561234569123456789012345",
+	"00123456123456812345678901234",
+};
+
+static const char *iban_pool[] = {
+	"GB82WEST12345698765432",
+	"DE89370400440532013000",
+	"MT90MALT011000012345MTLCAST001SABC",
+};
+
+
+static uint64_t rng_state = UINT64_C(0x9E3779B97F4A7C15);
+
+static uint32_t rnd(void)
+{
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return (uint32_t)((rng_state * UINT64_C(0x2545F4914F6CDD1D)) >> 32);
+}
+
+static uint32_t rnd_below(const uint32_t n)
+{
+	return rnd() % n;
+}
+
+
+static const char* cset_chars(const char cset)
+{
+	switch (cset) {
+	case 'N': return "0123456789";
+	case 'Y': return "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-/#";
+	case 'Z': return "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz-_";
+	default:  return "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-";
+	}
+}
+
+
+static bool has_linter(const gs1_dict_component_t* const c, const gs1_linter_t fn)
+{
+	unsigned int i;
+	for (i = 0; i < c->num_linters; i++)
+		if (c->linters[i] == fn)
+			return true;
+	return false;
+}
+
+
+static size_t from_pool(const char** const pool, const size_t num, char* const out)
+{
+	const char *v = pool[rnd_below((uint32_t)num)];
+	const size_t len = strlen(v);
+	memcpy(out, v, len);
+	return len;
+}
+
+
+/*
+ *  Generate a valid value for a component, returning its length or zero if
+ *  no valid value was found.
+ *
+ */
+static size_t gen_component(const gs1_dict_component_t* const c, char* const out)
+{
+
+	const char *chars = cset_chars(c->cset);
+	const uint32_t num_chars = (uint32_t)strlen(chars);
+	const size_t typical_max = c->max < 20 ? c->max : 20;
+	unsigned int attempt;
+
+	if (has_linter(c, gs1_lint_couponcode))
+		return from_pool(couponcode_pool, sizeof(couponcode_pool) / sizeof(couponcode_pool[0]), out);
+	if (has_linter(c, gs1_lint_couponposoffer))
+		return from_pool(couponposoffer_pool, sizeof(couponposoffer_pool) / sizeof(couponposoffer_pool[0]), out);
+	if (has_linter(c, gs1_lint_iban))
+		return from_pool(iban_pool, sizeof(iban_pool) / sizeof(iban_pool[0]), out);
+
+	for (attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+
+		const size_t len = c->min + rnd_below((uint32_t)(typical_max - c->min + 1));
+		size_t i;
+
+		for (i = 0; i < len; i++)
+			out[i] = chars[rnd_below(num_chars)];
+
+		/*
+		 *  Fix up the check digit rather than waiting for a match.
+		 *
+		 */
+		if (has_linter(c, gs1_lint_csum) && len > 1) {
+			unsigned int sum = 0;
+			for (i = 0; i < len - 1; i++)
+				sum += (unsigned int)(out[len - 2 - i] - '0') * (i % 2 == 0 ? 3 : 1);
+			out[len - 1] = (char)('0' + (10 - sum % 10) % 10);
+		}
+
+		if (bench_lint_component(c, out, len))
+			return len;
+
+	}
+
+	return 0;
+
+}
+
+
+/*
+ *  Substitute one character of the value with another from the character
+ *  set of its component.
+ *
+ */
+static void corrupt(const gs1_dict_entry_t* const e, char* const value, const size_t* const comp_len)
+{
+
+	unsigned int k, n = 0;
+	size_t off = 0, pos;
+	const char *chars;
+	char ch;
+
+	for (k = 0; k < e->num_components; k++)
+		if (comp_len[k])
+			n++;
+	if (n == 0)
+		return;
+	n = rnd_below(n);
+	for (k = 0; ; k++) {
+		if (comp_len[k] && n-- == 0)
+			break;
+		off += comp_len[k];
+	}
+
+	chars = cset_chars(e->components[k].cset);
+	pos = off + rnd_below((uint32_t)comp_len[k]);
+	do {
+		ch = chars[rnd_below((uint32_t)strlen(chars))];
+	} while (ch == value[pos]);
+	value[pos] = ch;
+
+}
+
+
+/*
+ *  Generate a label from a template, returning false if it cannot be done.
+ *
+ */
+static bool gen_label(const gs1_dict_t* const dict, const struct template_s* const t, const bool with_error, char* const out, size_t* const out_len)
+{
+
+	const gs1_dict_entry_t *entries[MAX_TEMPLATE_AIS];
+	size_t value_pos[MAX_TEMPLATE_AIS], comp_len[MAX_TEMPLATE_AIS][GS1_DICT_MAX_COMPONENTS];
+	size_t len = 0, num = 0, i;
+	bool fnc1_needed = false;
+
+	out[len++] = BENCH_FNC1;
+
+	for (i = 0; i < MAX_TEMPLATE_AIS && t->ais[i].ai; i++) {
+
+		const gs1_dict_entry_t *e;
+		unsigned int k;
+
+		if (rnd_below(100) >= t->ais[i].percent)
+			continue;
+
+		e = gs1_dict_lookup(dict, t->ais[i].ai, strlen(t->ais[i].ai));
+		if (!e) {
+			fprintf(stderr, "AI (%s) is not in the Syntax Dictionary\n", t->ais[i].ai);
+			return false;
+		}
+
+		if (fnc1_needed)
+			out[len++] = BENCH_FNC1;
+
+		memcpy(&out[len], e->ai, strlen(e->ai));
+		len += strlen(e->ai);
+		value_pos[num] = len;
+
+		for (k = 0; k < e->num_components; k++) {
+			size_t n = 0;
+			if (!e->components[k].optional || rnd_below(2) == 0) {
+				if (len + e->components[k].max >= MAX_LABEL)
+					return false;
+				n = gen_component(&e->components[k], &out[len]);
+				if (n == 0) {
+					fprintf(stderr, "Unable to generate a value for AI (%s)\n", e->ai);
+					return false;
+				}
+			}
+			comp_len[num][k] = n;
+			len += n;
+			if (n == 0)
+				break;	// Later optional components are omitted too
+		}
+		for (k++; k < e->num_components; k++)
+			comp_len[num][k] = 0;
+
+		entries[num++] = e;
+		fnc1_needed = !(e->flags & GS1_DICT_FLAG_NO_FNC1);
+
+	}
+
+	if (with_error && num > 0) {
+		const size_t j = rnd_below((uint32_t)num);
+		corrupt(entries[j], &out[value_pos[j]], comp_len[j]);
+	}
+
+	*out_len = len;
+	return true;
+
+}
+
+
+static bool parse_mix(const char* const mix, unsigned int* const weights)
+{
+
+	const char *p = mix;
+	size_t i;
+
+	for (i = 0; i < NUM_PROFILES; i++)
+		weights[i] = 0;
+
+	while (*p) {
+		const char *eq = strchr(p, '=');
+		char *end;
+		unsigned long w;
+		if (!eq)
+			return false;
+		for (i = 0; i < NUM_PROFILES; i++)
+			if (strlen(profiles[i].name) == (size_t)(eq - p) && strncmp(profiles[i].name, p, (size_t)(eq - p)) == 0)
+				break;
+		if (i == NUM_PROFILES)
+			return false;
+		w = strtoul(eq + 1, &end, 10);
+		if (end == eq + 1 || w > 1000 || (*end && *end != ','))
+			return false;
+		weights[i] = (unsigned int)w;
+		p = *end ? end + 1 : end;
+	}
+
+	return true;
+
+}
+
+
+static void usage(const char* const prog)
+{
+	fprintf(stderr, "Usage: %s -d gs1-syntax-dictionary.txt [-n count] [-m profile=weight,...] [-e error_rate] [-s seed]\n", prog);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "  -n count       Number of labels (default 1000000)\n");
+	fprintf(stderr, "  -m mix         Profile weights (default logistics=50,healthcare=40,coupon=10)\n");
+	fprintf(stderr, "  -e error_rate  Fraction of labels with a substituted character (default 0.01)\n");
+	fprintf(stderr, "  -s seed        Random seed (default 1)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+
+	const char *dict_path = NULL;
+	const char *mix = "logistics=50,healthcare=40,coupon=10";
+	unsigned long count = 1000000, n, seed = 1;
+	unsigned int weights[NUM_PROFILES], total = 0;
+	double error_rate = 0.01;
+	gs1_dict_t *dict;
+	size_t err_line, i;
+	int a;
+	char label[MAX_LABEL + 1];
+
+	for (a = 1; a < argc; a++) {
+		const char *v = a + 1 < argc ? argv[a + 1] : NULL;
+		if (!v || argv[a][0] != '-' || argv[a][1] == '\0' || argv[a][2] != '\0') {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		switch (argv[a][1]) {
+		case 'd': dict_path = v; break;
+		case 'n': count = strtoul(v, NULL, 10); break;
+		case 'm': mix = v; break;
+		case 'e': error_rate = strtod(v, NULL); break;
+		case 's': seed = strtoul(v, NULL, 10); break;
+		default:
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		a++;
+	}
+
+	if (!dict_path || !parse_mix(mix, weights) || error_rate < 0 || error_rate > 1) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	for (i = 0; i < NUM_PROFILES; i++)
+		total += weights[i];
+	if (total == 0) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	dict = gs1_dict_load_file(dict_path, &err_line);
+	if (!dict) {
+		fprintf(stderr, "Unable to load %s (line %zu)\n", dict_path, err_line);
+		return EXIT_FAILURE;
+	}
+
+	rng_state ^= (uint64_t)seed * UINT64_C(0xBF58476D1CE4E5B9);
+	if (rng_state == 0)
+		rng_state = 1;
+
+	for (n = 0; n < count; n++) {
+
+		const struct profile_s *p;
+		const bool with_error = (double)rnd() / 4294967296.0 < error_rate;
+		uint32_t r = rnd_below(total);
+		size_t len;
+
+		for (i = 0; r >= weights[i]; i++)
+			r -= weights[i];
+		p = &profiles[i];
+
+		if (!gen_label(dict, &p->templates[rnd_below((uint32_t)p->num_templates)], with_error, label, &len)) {
+			gs1_dict_free(dict);
+			return EXIT_FAILURE;
+		}
+
+		label[len++] = '\n';
+		fwrite(label, 1, len, stdout);
+
+	}
+
+	gs1_dict_free(dict);
+
+	return EXIT_SUCCESS;
+
+}
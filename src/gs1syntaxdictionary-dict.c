@@ -0,0 +1,1546 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-dict.c
+ *
+ * @brief Loading of the GS1 Barcode Syntax Dictionary into memory, and
+ * atomic replacement of the dictionary in use by a long-running process.
+ *
+ * A dictionary is parsed from the text of a `gs1-syntax-dictionary.txt`
+ * release into an entry for each AI, with the linter names resolved to the
+ * reference linter functions, and an index of the entries by AI.
+ *
+ * The entries, component specifications, attributes and titles are interned
+ * in a store. Several releases may be loaded into one store, in which case
+ * the data that is common to the releases, typically almost all of it, is
+ * held once and shared. Each release retains its own index. A dictionary
+ * loaded with gs1_dict_load() has a store of its own.
+ *
+ * A process may install a dictionary as the current dictionary and later
+ * install a newer release in its place while other threads continue to
+ * validate data. Readers obtain the current dictionary with gs1_dict_enter()
+ * and release it with gs1_dict_exit(); these never block. A replaced
+ * dictionary is freed once no reader can still be using it.
+ *
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+#define GS1_DICT_MAX_FILE_SIZE (16 * 1024 * 1024)
+
+
+#define GS1_DICT_STORE_CHUNK_SIZE 16384
+#define GS1_DICT_STORE_INITIAL_ITEMS 16
+
+
+/*
+ * Allocations from a store are aligned for any of the types held within it.
+ *
+ */
+typedef union {
+	void *p;
+	uint64_t u;
+	gs1_linter_t fn;
+} store_align_t;
+
+
+struct store_chunk_s {
+	struct store_chunk_s *next;
+	size_t size;
+	size_t used;
+	store_align_t data[];
+};
+
+
+/*
+ * Hash table slot referring to an interned item.
+ *
+ */
+struct store_item_s {
+	uint32_t hash;
+	size_t size;
+	const void *ptr;
+};
+
+
+struct gs1_dict_store_s {
+	struct store_chunk_s *chunks;
+	size_t bytes;
+	struct store_item_s *items;
+	size_t items_cap;
+	size_t items_num;
+	gs1_dict_t * volatile releases;
+	gs1_arena_t *arena;		// If not NULL, the source of all memory for the store
+};
+
+
+/*
+ * A release of the dictionary. The entries are sorted by AI, and the entries
+ * whose AI begins with the two digits "pp" are entries[first[pp]] up to,
+ * but excluding, entries[first[pp + 1]].
+ *
+ * AIs have between two and four digits, so a release holds fewer than 11200
+ * entries and the offsets fit in 16 bits.
+ *
+ */
+struct gs1_dict_s {
+	const char *release;
+	size_t num_entries;
+	const gs1_dict_entry_t **entries;
+	uint16_t first[101];
+	gs1_dict_store_t *store;
+	bool private_store;
+	const gs1_dict_t *next;
+};
+
+
+/*
+ * The parsed form of a single line of the dictionary, before any range of
+ * AIs is expanded.
+ *
+ */
+struct dict_line_s {
+	unsigned int ai_lo;
+	unsigned int ai_hi;
+	size_t ai_len;
+	unsigned char flags;
+	unsigned char num_components;
+	gs1_dict_component_t components[GS1_DICT_MAX_COMPONENTS];
+	const char *attrs;
+	size_t attrs_len;
+	const char *title;
+	size_t title_len;
+};
+
+
+static gs1_dict_t * volatile current;
+
+
+static size_t next_token(const char* const p, const size_t len, size_t* const pos, const char** const tok)
+{
+
+	size_t start;
+
+	while (*pos < len && (p[*pos] == ' ' || p[*pos] == '\t'))
+		(*pos)++;
+
+	start = *pos;
+	while (*pos < len && p[*pos] != ' ' && p[*pos] != '\t')
+		(*pos)++;
+
+	*tok = &p[start];
+	return *pos - start;
+
+}
+
+
+/*
+ * Parse a solitary AI, e.g. "01", or a range of AIs of equal length, e.g.
+ * "3100-3105".
+ *
+ */
+static bool parse_ai(const char* const p, const size_t len, struct dict_line_s* const e)
+{
+
+	size_t i;
+	unsigned int v = 0;
+
+	for (i = 0; i < len && isdigit((unsigned char)p[i]); i++)
+		v = v * 10 + (unsigned int)(p[i] - '0');
+
+	if (i < 2 || i > 4)
+		return false;
+
+	e->ai_len = i;
+	e->ai_lo = e->ai_hi = v;
+
+	if (i == len)
+		return true;
+
+	if (p[i] != '-' || len != 2 * e->ai_len + 1)
+		return false;
+
+	v = 0;
+	for (i++; i < len; i++) {
+		if (!isdigit((unsigned char)p[i]))
+			return false;
+		v = v * 10 + (unsigned int)(p[i] - '0');
+	}
+
+	if (v < e->ai_lo)
+		return false;
+
+	e->ai_hi = v;
+
+	return true;
+
+}
+
+
+/*
+ * Parse a component of the specification, e.g. "N13,csum,gcppos1",
+ * "[X..17]" or "[N2],mi".
+ *
+ */
+static bool parse_component(const char* const p, const size_t len, gs1_dict_component_t* const c)
+{
+
+	size_t i = 0;
+	unsigned int n = 0;
+	bool variable = false;
+
+	c->optional = false;
+	c->num_linters = 0;
+
+	if (p[i] == '[') {
+		c->optional = true;
+		i++;
+	}
+
+	if (i == len || !memchr("NXYZ", p[i], 4))
+		return false;
+	c->cset = p[i++];
+
+	if (len - i >= 2 && p[i] == '.' && p[i + 1] == '.') {
+		variable = true;
+		i += 2;
+	}
+
+	while (i < len && isdigit((unsigned char)p[i]) && n <= GS1_DICT_MAX_COMPONENT_LEN)
+		n = n * 10 + (unsigned int)(p[i++] - '0');
+	if (n == 0 || n > GS1_DICT_MAX_COMPONENT_LEN)
+		return false;
+
+	c->min = (unsigned char)(variable ? 1 : n);
+	c->max = (unsigned char)n;
+
+	if (c->optional) {
+		if (i == len || p[i] != ']')
+			return false;
+		i++;
+	}
+
+	while (i < len) {
+
+		char name[32];
+		size_t name_len = 0;
+		gs1_linter_t fn;
+
+		if (p[i++] != ',')
+			return false;
+
+		while (i < len && p[i] != ',' && name_len < sizeof(name) - 1)
+			name[name_len++] = p[i++];
+		name[name_len] = '\0';
+
+		fn = gs1_linter_from_name(name);
+		if (!fn || c->num_linters == GS1_DICT_MAX_LINTERS)
+			return false;
+
+		c->linters[c->num_linters++] = fn;
+
+	}
+
+	return true;
+
+}
+
+
+/*
+ * Parse an entry line of the form:
+ *
+ *     AIs  [Flags]  Specification  [Attributes...]  [# Title]
+ *
+ */
+static bool parse_entry(const char* const p, const size_t len, struct dict_line_s* const e)
+{
+
+	size_t pos = 0, tok_len, i;
+	const char *tok;
+
+	tok_len = next_token(p, len, &pos, &tok);
+	if (!parse_ai(tok, tok_len, e))
+		return false;
+
+	memset(e->components, 0, sizeof(e->components));
+	e->flags = 0;
+	e->num_components = 0;
+	e->attrs = "";
+	e->attrs_len = 0;
+	e->title = "";
+	e->title_len = 0;
+
+	/*
+	 * Flags consist only of punctuation, which distinguishes them from a
+	 * specification component such as "[X..17]".
+	 *
+	 */
+	tok_len = next_token(p, len, &pos, &tok);
+	for (i = 0; i < tok_len && !isalnum((unsigned char)tok[i]); i++) {
+		if (tok[i] == '*')
+			e->flags |= GS1_DICT_FLAG_NO_FNC1;
+		else if (tok[i] == '?')
+			e->flags |= GS1_DICT_FLAG_DL_DATA_ATTR;
+	}
+	if (tok_len > 0 && i == tok_len)
+		tok_len = next_token(p, len, &pos, &tok);
+
+	/*
+	 * Only the final component may have variable length and no mandatory
+	 * component may follow an optional component.
+	 *
+	 */
+	while (tok_len > 0 && memchr("[NXYZ", tok[0], 5)) {
+
+		gs1_dict_component_t *c = &e->components[e->num_components];
+
+		if (e->num_components == GS1_DICT_MAX_COMPONENTS || !parse_component(tok, tok_len, c))
+			return false;
+
+		if (e->num_components > 0 &&
+		    (c[-1].min != c[-1].max || (c[-1].optional && !c->optional)))
+			return false;
+
+		e->num_components++;
+		tok_len = next_token(p, len, &pos, &tok);
+
+	}
+
+	if (e->num_components == 0)
+		return false;
+
+	while (tok_len > 0 && tok[0] != '#') {
+		if (e->attrs_len == 0)
+			e->attrs = tok;
+		e->attrs_len = (size_t)(tok + tok_len - e->attrs);
+		tok_len = next_token(p, len, &pos, &tok);
+	}
+
+	if (tok_len > 0) {
+		e->title = tok + 1;
+		while (e->title < p + len && (*e->title == ' ' || *e->title == '\t'))
+			e->title++;
+		e->title_len = (size_t)(p + len - e->title);
+		while (e->title_len > 0 && isspace((unsigned char)e->title[e->title_len - 1]))
+			e->title_len--;
+	}
+
+	return true;
+
+}
+
+
+/*
+ * Working memory for a store comes from its arena, if it has one, and
+ * otherwise from the heap. Memory from an arena is never freed individually.
+ *
+ */
+static void* store_mem_alloc(gs1_dict_store_t* const store, const size_t size)
+{
+	return store->arena ? gs1_arena_alloc(store->arena, size) : malloc(size);
+}
+
+static void store_mem_free(const gs1_dict_store_t* const store, void* const p)
+{
+	if (!store->arena)
+		free(p);
+}
+
+
+/*
+ * Allocate storage from a store, which is released only when the store is
+ * freed.
+ *
+ */
+static void* store_alloc(gs1_dict_store_t* const store, size_t size)
+{
+
+	struct store_chunk_s *chunk = store->chunks;
+	void *p;
+
+	size = (size + sizeof(store_align_t) - 1) / sizeof(store_align_t) * sizeof(store_align_t);
+
+	if (store->arena) {
+		p = gs1_arena_alloc(store->arena, size);
+		if (GS1_LINTER_UNLIKELY(!p)) return NULL;
+		store->bytes += size;
+		return p;
+	}
+
+	if (!chunk || chunk->size - chunk->used < size) {
+		const size_t chunk_size = size > GS1_DICT_STORE_CHUNK_SIZE ? size : GS1_DICT_STORE_CHUNK_SIZE;
+		chunk = (struct store_chunk_s *)malloc(sizeof(struct store_chunk_s) + chunk_size);
+		if (GS1_LINTER_UNLIKELY(!chunk)) return NULL;
+		chunk->next = store->chunks;
+		chunk->size = chunk_size;
+		chunk->used = 0;
+		store->chunks = chunk;
+	}
+
+	p = (char *)chunk->data + chunk->used;
+	chunk->used += size;
+	store->bytes += size;
+
+	return p;
+
+}
+
+
+static uint32_t store_hash(const void* const data, const size_t size, const bool nul)
+{
+
+	const unsigned char *p = (const unsigned char *)data;
+	uint32_t h = UINT32_C(2166136261);
+	size_t i;
+
+	for (i = 0; i < size; i++)
+		h = (h ^ p[i]) * UINT32_C(16777619);
+	if (nul)
+		h *= UINT32_C(16777619);
+
+	return h;
+
+}
+
+
+static bool store_grow(gs1_dict_store_t* const store)
+{
+
+	const size_t cap = store->items_cap ? store->items_cap * 2 : GS1_DICT_STORE_INITIAL_ITEMS;
+	struct store_item_s *items;
+	size_t i;
+
+	items = (struct store_item_s *)store_mem_alloc(store, cap * sizeof(struct store_item_s));
+	if (GS1_LINTER_UNLIKELY(!items)) return false;
+	memset(items, 0, cap * sizeof(struct store_item_s));
+
+	for (i = 0; i < store->items_cap; i++) {
+		size_t j;
+		if (!store->items[i].ptr)
+			continue;
+		for (j = store->items[i].hash & (cap - 1); items[j].ptr; j = (j + 1) & (cap - 1))
+			;
+		items[j] = store->items[i];
+	}
+
+	store_mem_free(store, store->items);
+	store->items = items;
+	store->items_cap = cap;
+
+	return true;
+
+}
+
+
+/*
+ * Return a stored copy of the given data, sharing any identical copy that is
+ * already held by the store. If `nul` is set then the data is a string that is
+ * stored with a NUL terminator.
+ *
+ */
+static const void* store_intern(gs1_dict_store_t* const store, const void* const data, const size_t size, const bool nul)
+{
+
+	const uint32_t hash = store_hash(data, size, nul);
+	const size_t stored_size = size + (nul ? 1 : 0);
+	size_t i;
+	char *p;
+
+	if (store->items_num * 2 >= store->items_cap && !store_grow(store))
+		return NULL;
+
+	for (i = hash & (store->items_cap - 1); store->items[i].ptr; i = (i + 1) & (store->items_cap - 1)) {
+		const struct store_item_s *item = &store->items[i];
+		if (item->hash == hash && item->size == stored_size && memcmp(item->ptr, data, size) == 0 &&
+		    (!nul || ((const char *)item->ptr)[size] == '\0'))
+			return item->ptr;
+	}
+
+	p = (char *)store_alloc(store, stored_size);
+	if (GS1_LINTER_UNLIKELY(!p)) return NULL;
+	memcpy(p, data, size);
+	if (nul)
+		p[size] = '\0';
+
+	store->items[i].hash = hash;
+	store->items[i].size = stored_size;
+	store->items[i].ptr = p;
+	store->items_num++;
+
+	return p;
+
+}
+
+
+/*
+ * State carried between lines while parsing the dictionary text.
+ *
+ */
+struct dict_parse_s {
+	const gs1_dict_entry_t **vec;
+	size_t vec_num;
+	size_t vec_cap;
+	const char *release;
+	char prev[5];
+};
+
+enum dict_parse_status {
+	DICT_PARSE_OK,
+	DICT_PARSE_INVALID,
+	DICT_PARSE_NOMEM,
+};
+
+
+/*
+ * Parse a line of the dictionary text, interning any entries that it defines.
+ *
+ */
+static enum dict_parse_status dict_parse_line(gs1_dict_store_t* const store, const char* const line, const size_t line_len, struct dict_parse_s* const st)
+{
+
+	struct dict_line_s e;
+	const gs1_dict_component_t *components;
+	const char *attrs, *title;
+	unsigned int ai;
+
+	/*
+	 * Comments, including the "Release:" header, and blank lines.
+	 *
+	 */
+	if (line_len == 0 || line[0] == '#' || line[0] == ' ' || line[0] == '\t') {
+
+		static const char tag[] = "Release:";
+		size_t pos = 0, tok_len;
+		const char *tok;
+
+		tok_len = next_token(line, line_len, &pos, &tok);
+		if (tok_len > 0 && line[0] != '#')
+			return DICT_PARSE_INVALID;
+
+		if (tok_len == 1 && st->vec_num == 0) {
+			tok_len = next_token(line, line_len, &pos, &tok);
+			if (tok_len == sizeof(tag) - 1 && memcmp(tok, tag, tok_len) == 0) {
+				tok_len = next_token(line, line_len, &pos, &tok);
+				st->release = (const char *)store_intern(store, tok, tok_len, true);
+				if (GS1_LINTER_UNLIKELY(!st->release)) return DICT_PARSE_NOMEM;
+			}
+		}
+
+		return DICT_PARSE_OK;
+
+	}
+
+	if (!parse_entry(line, line_len, &e))
+		return DICT_PARSE_INVALID;
+
+	components = (const gs1_dict_component_t *)store_intern(store, e.components, e.num_components * sizeof(e.components[0]), false);
+	attrs = (const char *)store_intern(store, e.attrs, e.attrs_len, true);
+	title = (const char *)store_intern(store, e.title, e.title_len, true);
+	if (GS1_LINTER_UNLIKELY(!components || !attrs || !title)) return DICT_PARSE_NOMEM;
+
+	for (ai = e.ai_lo; ai <= e.ai_hi; ai++) {
+
+		gs1_dict_entry_t entry;
+		unsigned int v = ai;
+		size_t i;
+
+		memset(&entry, 0, sizeof(entry));
+		for (i = e.ai_len; i > 0; i--, v /= 10)
+			entry.ai[i - 1] = (char)('0' + v % 10);
+
+		/*
+		 * Entries must be in lexical order of AI.
+		 *
+		 */
+		if (strcmp(entry.ai, st->prev) <= 0)
+			return DICT_PARSE_INVALID;
+		memcpy(st->prev, entry.ai, sizeof(st->prev));
+
+		entry.flags = e.flags;
+		entry.num_components = e.num_components;
+		entry.components = components;
+		entry.attrs = attrs;
+		entry.title = title;
+
+		if (st->vec_num == st->vec_cap) {
+			const size_t cap = st->vec_cap ? st->vec_cap * 2 : 256;
+			const gs1_dict_entry_t **vec = (const gs1_dict_entry_t **)store_mem_alloc(store, cap * sizeof(vec[0]));
+			if (GS1_LINTER_UNLIKELY(!vec)) return DICT_PARSE_NOMEM;
+			if (st->vec_num)
+				memcpy((void *)vec, (const void *)st->vec, st->vec_num * sizeof(vec[0]));
+			store_mem_free(store, (void *)st->vec);
+			st->vec = vec;
+			st->vec_cap = cap;
+		}
+
+		st->vec[st->vec_num] = (const gs1_dict_entry_t *)store_intern(store, &entry, sizeof(entry), false);
+		if (GS1_LINTER_UNLIKELY(!st->vec[st->vec_num])) return DICT_PARSE_NOMEM;
+		st->vec_num++;
+
+	}
+
+	return DICT_PARSE_OK;
+
+}
+
+
+/*
+ * Parse the dictionary text into a dictionary held by the given store.
+ *
+ * On failure, anything interned before the failure remains in the store.
+ *
+ */
+static gs1_dict_t* dict_parse(gs1_dict_store_t* const store, const char* const data, const size_t data_len, size_t* const err_line)
+{
+
+	struct dict_parse_s st = { NULL, 0, 0, "", "" };
+	size_t pos = 0, line_no = 0, i, p;
+	gs1_dict_t *dict = NULL;
+
+	*err_line = 0;
+
+	while (pos < data_len) {
+
+		const char *line = &data[pos];
+		const char *eol = (const char *)memchr(line, '\n', data_len - pos);
+		size_t line_len = eol ? (size_t)(eol - line) : data_len - pos;
+		enum dict_parse_status status;
+
+		pos += line_len + 1;
+		line_no++;
+
+		if (line_len > 0 && line[line_len - 1] == '\r')
+			line_len--;
+
+		status = dict_parse_line(store, line, line_len, &st);
+		if (status != DICT_PARSE_OK) {
+			if (status == DICT_PARSE_INVALID)
+				*err_line = line_no;
+			store_mem_free(store, (void *)st.vec);
+			return NULL;
+		}
+
+	}
+
+	assert(st.vec_num <= UINT16_MAX);
+	if (st.vec_num > 0)
+		dict = (gs1_dict_t *)store_alloc(store, sizeof(gs1_dict_t) + st.vec_num * sizeof(st.vec[0]));
+	if (!dict) {
+		store_mem_free(store, (void *)st.vec);
+		return NULL;
+	}
+
+	dict->release = st.release;
+	dict->num_entries = st.vec_num;
+	dict->entries = (const gs1_dict_entry_t **)(dict + 1);
+	memcpy((void *)dict->entries, (const void *)st.vec, st.vec_num * sizeof(st.vec[0]));
+	dict->store = store;
+	dict->private_store = false;
+	dict->next = NULL;
+	store_mem_free(store, (void *)st.vec);
+
+	/*
+	 * Index the position of the first entry for each two-digit AI prefix.
+	 *
+	 */
+	for (i = 0, p = 0; p <= 100; p++) {
+		while (i < dict->num_entries && (size_t)(dict->entries[i]->ai[0] - '0') * 10 + (size_t)(dict->entries[i]->ai[1] - '0') < p)
+			i++;
+		dict->first[p] = (uint16_t)i;
+	}
+
+	return dict;
+
+}
+
+
+/**
+ * Create an empty store into which releases of the Syntax Dictionary may be
+ * loaded with gs1_dict_store_load().
+ *
+ * @return A store that must be released with gs1_dict_store_free().
+ * @return `NULL` if memory could not be allocated.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_dict_store_t* gs1_dict_store_new(void)
+{
+	return (gs1_dict_store_t *)calloc(1, sizeof(gs1_dict_store_t));
+}
+
+
+/**
+ * Create an empty store, as for gs1_dict_store_new(), that takes all of its
+ * memory from an arena rather than from the heap.
+ *
+ * Loading a release allocates nothing from the heap, except for the file
+ * buffer used by gs1_dict_store_load_file(). The memory is released with the
+ * arena, so gs1_dict_store_free() need not be called, and nothing allocated
+ * from the arena before the store may be released separately.
+ *
+ * The arena also holds the hash table used to share data between releases,
+ * and working storage that is outgrown while loading is not reclaimed until
+ * the arena is reset. Loading the full Syntax Dictionary therefore takes
+ * several times the size reported by gs1_dict_store_size(), currently about
+ * 150 KB on a 64-bit platform.
+ *
+ * @param [in,out] arena The arena. Must not be `NULL`.
+ *
+ * @return A store that is valid until the arena is reset.
+ * @return `NULL` if the arena has insufficient space remaining.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_dict_store_t* gs1_dict_store_new_arena(gs1_arena_t* const arena)
+{
+
+	gs1_dict_store_t *store;
+
+	assert(arena);
+
+	store = (gs1_dict_store_t *)gs1_arena_alloc(arena, sizeof(gs1_dict_store_t));
+	if (GS1_LINTER_UNLIKELY(!store)) return NULL;
+
+	memset(store, 0, sizeof(gs1_dict_store_t));
+	store->arena = arena;
+
+	return store;
+
+}
+
+
+/**
+ * Release a store, together with all of the dictionaries loaded into it.
+ *
+ * @param [in] store The store to release. May be `NULL`. A store
+ *                   created with gs1_dict_store_new_arena() is left to be
+ *                   released with its arena.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_store_free(gs1_dict_store_t* const store)
+{
+
+	struct store_chunk_s *chunk;
+
+	if (!store || store->arena)
+		return;
+
+	while ((chunk = store->chunks) != NULL) {
+		store->chunks = chunk->next;
+		free(chunk);
+	}
+
+	free(store->items);
+	free(store);
+
+}
+
+
+/**
+ * Load a release of the Syntax Dictionary into a store.
+ *
+ * Entries, component specifications, attributes and titles that are
+ * identical to those of a release that is already in the store are shared
+ * with it, so that each additional release costs little more than its index.
+ *
+ * Loading into a store must be serialised by the caller. Concurrent readers
+ * of the releases already in the store, including gs1_dict_store_find(), are
+ * not affected and are never blocked.
+ *
+ * @param [in,out] store The store. Must not be `NULL`.
+ * @param [in] data Pointer to the dictionary text. Must not be `NULL`.
+ * @param [in] data_len Length of the dictionary text.
+ * @param [out] err_line As for gs1_dict_load(). Also zero if the store already
+ *                       holds a release with the same `Release:` header.
+ *
+ * @return The loaded release, which remains valid until the store is freed.
+ * @return `NULL` if the dictionary is invalid, duplicates a release already in
+ *         the store or memory could not be allocated. Any storage consumed by
+ *         the failed load is held until the store is freed.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_load(gs1_dict_store_t* const store, const char* const data, const size_t data_len, size_t* const err_line)
+{
+
+	size_t line_no;
+	gs1_dict_t *dict;
+
+	assert(store);
+	assert(data);
+
+	dict = dict_parse(store, data, data_len, &line_no);
+	if (dict && gs1_dict_store_find(store, dict->release))
+		dict = NULL;
+
+	if (!dict) {
+		if (err_line)
+			*err_line = line_no;
+		return NULL;
+	}
+
+	dict->next = store->releases;
+	(void)GS1_LINTER_ATOMIC_XCHG_PTR(&store->releases, dict);
+
+	return dict;
+
+}
+
+
+/**
+ * Load a release of the Syntax Dictionary from a file into a store.
+ *
+ * @param [in,out] store The store. Must not be `NULL`.
+ * @param [in] path Path to the file. Must not be `NULL`.
+ * @param [out] err_line As for gs1_dict_store_load(). Zero if the file cannot
+ *                       be read.
+ *
+ * @return As for gs1_dict_store_load().
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_load_file(gs1_dict_store_t* const store, const char* const path, size_t* const err_line)
+{
+
+	char *buf;
+	size_t len;
+	const gs1_dict_t *dict;
+
+	assert(path);
+
+	buf = gs1_lint_read_file(path, GS1_DICT_MAX_FILE_SIZE, &len);
+	if (!buf) {
+		if (err_line)
+			*err_line = 0;
+		return NULL;
+	}
+
+	dict = gs1_dict_store_load(store, buf, len, err_line);
+	free(buf);
+
+	return dict;
+
+}
+
+
+/**
+ * Find a release held by a store.
+ *
+ * @param [in] store The store. Must not be `NULL`.
+ * @param [in] release The release, as given by the `Release:` header of the
+ *                     dictionary. Must not be `NULL`.
+ *
+ * @return The release.
+ * @return `NULL` if the store holds no such release.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_find(const gs1_dict_store_t* const store, const char* const release)
+{
+
+	const gs1_dict_t *dict;
+
+	assert(store);
+	assert(release);
+
+	for (dict = (const gs1_dict_t *)GS1_LINTER_ATOMIC_LOAD_PTR(&store->releases); dict; dict = dict->next)
+		if (strcmp(dict->release, release) == 0)
+			return dict;
+
+	return NULL;
+
+}
+
+
+/**
+ * Return the number of bytes of dictionary data held by a store.
+ *
+ * @param [in] store The store. Must not be `NULL`.
+ *
+ * @return The number of bytes.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_dict_store_size(const gs1_dict_store_t* const store)
+{
+	assert(store);
+	return store->bytes;
+}
+
+
+/**
+ * Load a Syntax Dictionary from the text of a `gs1-syntax-dictionary.txt`
+ * release.
+ *
+ * The returned dictionary does not refer to the given data, which may be
+ * released as soon as this function returns.
+ *
+ * @param [in] data Pointer to the dictionary text. Must not be `NULL`.
+ * @param [in] data_len Length of the dictionary text.
+ * @param [out] err_line If not `NULL` then on failure the line number of the
+ *                       first invalid line is written to this pointer, or
+ *                       zero if the dictionary has no entries or memory could
+ *                       not be allocated.
+ *
+ * @return A dictionary that must be released with gs1_dict_free() or passed
+ *         to gs1_dict_install().
+ * @return `NULL` if the dictionary is invalid or memory could not be
+ *         allocated.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_dict_t* gs1_dict_load(const char* const data, const size_t data_len, size_t* const err_line)
+{
+
+	gs1_dict_store_t *store;
+	gs1_dict_t *dict;
+	size_t line_no = 0;
+
+	assert(data);
+
+	store = gs1_dict_store_new();
+	dict = store ? dict_parse(store, data, data_len, &line_no) : NULL;
+	if (!dict) {
+		gs1_dict_store_free(store);
+		if (err_line)
+			*err_line = line_no;
+		return NULL;
+	}
+
+	dict->private_store = true;
+
+	return dict;
+
+}
+
+
+/**
+ * Load a Syntax Dictionary from a `gs1-syntax-dictionary.txt` file.
+ *
+ * @param [in] path Path to the file. Must not be `NULL`.
+ * @param [out] err_line As for gs1_dict_load(). Zero if the file cannot be
+ *                       read.
+ *
+ * @return As for gs1_dict_load().
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_dict_t* gs1_dict_load_file(const char* const path, size_t* const err_line)
+{
+
+	char *buf;
+	size_t len;
+	gs1_dict_t *dict;
+
+	assert(path);
+
+	buf = gs1_lint_read_file(path, GS1_DICT_MAX_FILE_SIZE, &len);
+	if (!buf) {
+		if (err_line)
+			*err_line = 0;
+		return NULL;
+	}
+
+	dict = gs1_dict_load(buf, len, err_line);
+	free(buf);
+
+	return dict;
+
+}
+
+
+/**
+ * Release a dictionary obtained from gs1_dict_load() that has not been
+ * installed.
+ *
+ * @param [in] dict The dictionary to release. May be `NULL`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_free(gs1_dict_t* const dict)
+{
+	if (!dict)
+		return;
+	assert(dict->private_store);
+	gs1_dict_store_free(dict->store);
+}
+
+
+/**
+ * Return the release of a dictionary, as given by its `Release:` header.
+ *
+ * @param [in] dict The dictionary. Must not be `NULL`.
+ *
+ * @return The release, or an empty string if the dictionary has no
+ *         `Release:` header.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const char* gs1_dict_release(const gs1_dict_t* const dict)
+{
+	assert(dict);
+	return dict->release;
+}
+
+
+/**
+ * Return the number of entries in a dictionary, with AI ranges expanded.
+ *
+ * @param [in] dict The dictionary. Must not be `NULL`.
+ *
+ * @return The number of entries.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_dict_num_entries(const gs1_dict_t* const dict)
+{
+	assert(dict);
+	return dict->num_entries;
+}
+
+
+/**
+ * Return an entry of a dictionary by position, in lexical order of AI.
+ *
+ * @param [in] dict The dictionary. Must not be `NULL`.
+ * @param [in] idx Position of the entry, less than gs1_dict_num_entries().
+ *
+ * @return The entry.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_entry_t* gs1_dict_entry_at(const gs1_dict_t* const dict, const size_t idx)
+{
+	assert(dict);
+	assert(idx < dict->num_entries);
+	return dict->entries[idx];
+}
+
+
+/**
+ * Find the dictionary entry for an AI.
+ *
+ * The search is confined to the entries sharing the first two digits of the
+ * AI, located using the index held by the dictionary.
+ *
+ * @param [in] dict The dictionary. Must not be `NULL`.
+ * @param [in] ai Pointer to the AI, which need not be NUL terminated.
+ * @param [in] ai_len Length of the AI.
+ *
+ * @return The entry for the AI.
+ * @return `NULL` if the AI is not in the dictionary.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_entry_t* gs1_dict_lookup(const gs1_dict_t* const dict, const char* const ai, const size_t ai_len)
+{
+
+	size_t s, e, p;
+
+	assert(dict);
+	assert(ai);
+
+	if (ai_len < 2 || !isdigit((unsigned char)ai[0]) || !isdigit((unsigned char)ai[1]))
+		return NULL;
+
+	p = (size_t)(ai[0] - '0') * 10 + (size_t)(ai[1] - '0');
+	s = dict->first[p];
+	e = dict->first[p + 1];
+
+	while (s < e) {
+
+		const size_t m = s + (e - s) / 2;
+		const char *entry_ai = dict->entries[m]->ai;
+		const size_t entry_ai_len = strlen(entry_ai);
+		int cmp = memcmp(entry_ai, ai, entry_ai_len < ai_len ? entry_ai_len : ai_len);
+
+		if (cmp == 0 && entry_ai_len != ai_len)
+			cmp = entry_ai_len < ai_len ? -1 : 1;
+		if (cmp == 0)
+			return dict->entries[m];
+		if (cmp < 0)
+			s = m + 1;
+		else
+			e = m;
+
+	}
+
+	return NULL;
+
+}
+
+
+/**
+ * Install a dictionary as the current dictionary, replacing any dictionary
+ * that was previously installed.
+ *
+ * Readers are never blocked. A reader that obtained the previous dictionary
+ * with gs1_dict_enter() may continue to use it until it calls gs1_dict_exit(),
+ * after which the previous dictionary is freed. This function waits for any
+ * such readers, so it must not be called by a thread that is itself between
+ * gs1_dict_enter() and gs1_dict_exit().
+ *
+ * @param [in] dict A dictionary obtained from gs1_dict_load(), ownership of
+ *                  which passes to the library, or `NULL` to uninstall and
+ *                  free the current dictionary.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_install(gs1_dict_t* const dict)
+{
+
+	gs1_dict_t *old;
+
+	assert(!dict || dict->private_store);
+
+	old = (gs1_dict_t *)GS1_LINTER_ATOMIC_XCHG_PTR(&current, dict);
+	assert(!old || old != dict);
+
+	if (!old)
+		return;
+
+	gs1_lint_epoch_synchronize();
+	gs1_dict_free(old);
+
+}
+
+
+/**
+ * Obtain the current dictionary for reading.
+ *
+ * The dictionary remains valid, even if replaced by gs1_dict_install(), until
+ * the matching call to gs1_dict_exit(). Calls may be nested. This function
+ * never blocks.
+ *
+ * @param [out] guard State to be passed to gs1_dict_exit(). Must not be
+ *                    `NULL`.
+ *
+ * @return The current dictionary, or `NULL` if none is installed.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_enter(gs1_lint_epoch_guard_t* const guard)
+{
+	assert(guard);
+	gs1_lint_epoch_enter(guard);
+	return (const gs1_dict_t *)GS1_LINTER_ATOMIC_LOAD_PTR(&current);
+}
+
+
+/**
+ * Finish reading a dictionary obtained with gs1_dict_enter().
+ *
+ * @param [in] guard The state returned by the matching gs1_dict_enter().
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_exit(const gs1_lint_epoch_guard_t* const guard)
+{
+	assert(guard);
+	gs1_lint_epoch_exit(guard);
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+static const char test_dict[] =
+	"# Test dictionary\n"
+	"#\n"
+	"# Release: 2026-01-27\n"
+	"\n"
+	"00         *?  N18,csum,gcppos2                  dlpkey                  # SSCC\n"
+	"253         ?  N13,csum,gcppos1 [X..17]          dlpkey\n"
+	"3100-3105  *?  N6                                req=01,02 ex=310n       # NET WEIGHT (kg)\r\n"
+	"8008        ?  N6,yymmdd N2,hh [N2],mi [N2],ss   req=01,02,03            #PROD TIME  \n"
+	"  \t\n"
+	"91-99\t\t?\tX..90";
+
+static gs1_dict_t* test_load(const char* const text, size_t* const err_line)
+{
+	*err_line = 999;
+	return gs1_dict_load(text, strlen(text), err_line);
+}
+
+void test_gs1_dict_load(void)
+{
+
+	gs1_dict_t *dict;
+	const gs1_dict_entry_t *entry;
+	size_t err_line;
+
+	dict = test_load(test_dict, &err_line);
+	TEST_ASSERT(dict != NULL);
+	TEST_CHECK(err_line == 999);
+	TEST_CHECK(strcmp(gs1_dict_release(dict), "2026-01-27") == 0);
+	TEST_CHECK(gs1_dict_num_entries(dict) == 18);
+	TEST_CHECK(strcmp(gs1_dict_entry_at(dict, 0)->ai, "00") == 0);
+	TEST_CHECK(strcmp(gs1_dict_entry_at(dict, 17)->ai, "99") == 0);
+
+	TEST_ASSERT((entry = gs1_dict_lookup(dict, "00", 2)) != NULL);
+	TEST_CHECK(entry->flags == (GS1_DICT_FLAG_NO_FNC1 | GS1_DICT_FLAG_DL_DATA_ATTR));
+	TEST_CHECK(entry->num_components == 1);
+	TEST_CHECK(entry->components[0].cset == 'N');
+	TEST_CHECK(entry->components[0].min == 18 && entry->components[0].max == 18);
+	TEST_CHECK(!entry->components[0].optional);
+	TEST_CHECK(entry->components[0].num_linters == 2);
+	TEST_CHECK(entry->components[0].linters[0] == gs1_lint_csum);
+	TEST_CHECK(entry->components[0].linters[1] == gs1_lint_gcppos2);
+	TEST_CHECK(strcmp(entry->attrs, "dlpkey") == 0);
+	TEST_CHECK(strcmp(entry->title, "SSCC") == 0);
+
+	TEST_ASSERT((entry = gs1_dict_lookup(dict, "253", 3)) != NULL);
+	TEST_CHECK(entry->flags == GS1_DICT_FLAG_DL_DATA_ATTR);
+	TEST_CHECK(entry->num_components == 2);
+	TEST_CHECK(entry->components[1].cset == 'X');
+	TEST_CHECK(entry->components[1].optional);
+	TEST_CHECK(entry->components[1].min == 1 && entry->components[1].max == 17);
+	TEST_CHECK(entry->components[1].num_linters == 0);
+	TEST_CHECK(strcmp(entry->title, "") == 0);
+
+	TEST_ASSERT((entry = gs1_dict_lookup(dict, "3103", 4)) != NULL);
+	TEST_CHECK(strcmp(entry->attrs, "req=01,02 ex=310n") == 0);
+	TEST_CHECK(strcmp(entry->title, "NET WEIGHT (kg)") == 0);
+	TEST_CHECK(entry->components == gs1_dict_lookup(dict, "3100", 4)->components);
+
+	TEST_ASSERT((entry = gs1_dict_lookup(dict, "8008", 4)) != NULL);
+	TEST_CHECK(entry->num_components == 4);
+	TEST_CHECK(entry->components[1].linters[0] == gs1_lint_hh);
+	TEST_CHECK(entry->components[3].optional);
+	TEST_CHECK(strcmp(entry->title, "PROD TIME") == 0);
+
+	TEST_ASSERT((entry = gs1_dict_lookup(dict, "99", 2)) != NULL);
+	TEST_CHECK(entry->flags == GS1_DICT_FLAG_DL_DATA_ATTR);
+	TEST_CHECK(strcmp(entry->attrs, "") == 0);
+
+	TEST_CHECK(gs1_dict_lookup(dict, "0", 1) == NULL);
+	TEST_CHECK(gs1_dict_lookup(dict, "000", 3) == NULL);
+	TEST_CHECK(gs1_dict_lookup(dict, "3106", 4) == NULL);
+	TEST_CHECK(gs1_dict_lookup(dict, "90", 2) == NULL);
+
+	gs1_dict_free(dict);
+
+	/*
+	 * No Release header.
+	 *
+	 */
+	dict = test_load("01 N14\n", &err_line);
+	TEST_ASSERT(dict != NULL);
+	TEST_CHECK(strcmp(gs1_dict_release(dict), "") == 0);
+	gs1_dict_free(dict);
+
+	/*
+	 * Invalid dictionaries report the first bad line.
+	 *
+	 */
+	TEST_CHECK(!test_load("", &err_line) && err_line == 0);
+	TEST_CHECK(!test_load("# Release: X\n", &err_line) && err_line == 0);
+	TEST_CHECK(!test_load("01 N14\n 02 N14\n", &err_line) && err_line == 2);
+	TEST_CHECK(!test_load("0 N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00000 N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("3105-3100 N6", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("31-3100 N6", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("31+32 N6", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("31-3A N6", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 *", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 * req=01", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 [", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N0", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N..100", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 [N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1]", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1,", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1,unknown", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1,averyveryverylonglinternamethatexceedsthebuffer", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1,zero,zero,zero,zero,zero", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N1 N1 N1 N1 N1 N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 N..5 N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("00 [N1] N1", &err_line) && err_line == 1);
+	TEST_CHECK(!test_load("01 N1\n00 N1", &err_line) && err_line == 2);
+	TEST_CHECK(!test_load("00 N1\n00 N1", &err_line) && err_line == 2);
+	TEST_CHECK(!gs1_dict_load("0 N1", 4, NULL));
+	TEST_CHECK(!gs1_dict_load("", 0, NULL));
+
+	/*
+	 * Loading from a file.
+	 *
+	 */
+{
+	static const char *file = "test-dict.tmp";
+	FILE *fp;
+
+	err_line = 999;
+	TEST_CHECK(!gs1_dict_load_file("test-dict-missing.tmp", &err_line) && err_line == 0);
+	TEST_CHECK(!gs1_dict_load_file("test-dict-missing.tmp", NULL));
+
+	fp = fopen(file, "wb");
+	TEST_ASSERT(fp != NULL);
+	fputs(test_dict, fp);
+	fclose(fp);
+	dict = gs1_dict_load_file(file, &err_line);
+	remove(file);
+	TEST_ASSERT(dict != NULL);
+	TEST_CHECK(gs1_dict_num_entries(dict) == 18);
+	gs1_dict_free(dict);
+}
+
+}
+
+
+void test_gs1_dict_store(void)
+{
+
+	static const char release2[] =
+		"# Release: 2027-01-01\n"
+		"00         *?  N18,csum,gcppos2                  dlpkey                  # SSCC\n"
+		"01         *?  N14,csum,gcppos2                  dlpkey                  # GTIN\n"
+		"253         ?  N13,csum,gcppos1 [X..17]          dlpkey\n"
+		"255         ?  N13,csum,gcppos1 [X..17]          dlpkey\n"
+		"3100-3105  *?  N6                                req=01,02 ex=310n       # NET WEIGHT (kg)\n"
+		"8008        ?  N6,yymmdd N2,hh [N2],mi [N2],ss   req=01,02,03            # PROD TIME\n"
+		"91-99       ?  X..90\n";
+
+	gs1_dict_store_t *store;
+	const gs1_dict_t *r1, *r2;
+	size_t err_line, size1, size2, size_alone;
+
+	TEST_ASSERT((store = gs1_dict_store_new()) != NULL);
+	TEST_ASSERT(gs1_dict_store_load(store, release2, strlen(release2), NULL) != NULL);
+	size_alone = gs1_dict_store_size(store);
+	gs1_dict_store_free(store);
+
+	TEST_ASSERT((store = gs1_dict_store_new()) != NULL);
+
+	TEST_ASSERT((r1 = gs1_dict_store_load(store, test_dict, strlen(test_dict), &err_line)) != NULL);
+	size1 = gs1_dict_store_size(store);
+
+	/*
+	 * A second release shares all of the data that it has in common with the
+	 * first, so costs much less than when loaded alone.
+	 *
+	 */
+	TEST_ASSERT((r2 = gs1_dict_store_load(store, release2, strlen(release2), &err_line)) != NULL);
+	size2 = gs1_dict_store_size(store);
+	TEST_CHECK(size2 - size1 < size_alone / 2);
+	TEST_MSG("Shared release cost %zu bytes, alone %zu bytes", size2 - size1, size_alone);
+
+	TEST_CHECK(gs1_dict_num_entries(r1) == 18);
+	TEST_CHECK(gs1_dict_num_entries(r2) == 20);
+	TEST_CHECK(gs1_dict_lookup(r1, "01", 2) == NULL);
+	TEST_CHECK(gs1_dict_lookup(r2, "01", 2) != NULL);
+	TEST_CHECK(gs1_dict_lookup(r1, "00", 2) == gs1_dict_lookup(r2, "00", 2));
+	TEST_CHECK(gs1_dict_lookup(r1, "8008", 4) == gs1_dict_lookup(r2, "8008", 4));
+	TEST_CHECK(gs1_dict_lookup(r1, "3103", 4)->title == gs1_dict_lookup(r2, "3105", 4)->title);
+	TEST_CHECK(gs1_dict_lookup(r1, "253", 3)->components == gs1_dict_lookup(r2, "255", 3)->components);
+	TEST_CHECK(gs1_dict_lookup(r1, "A0", 2) == NULL);
+	TEST_CHECK(gs1_dict_lookup(r1, "0A", 2) == NULL);
+
+	TEST_CHECK(gs1_dict_store_find(store, "2026-01-27") == r1);
+	TEST_CHECK(gs1_dict_store_find(store, "2027-01-01") == r2);
+	TEST_CHECK(gs1_dict_store_find(store, "2028-01-01") == NULL);
+
+	/*
+	 * Duplicate and invalid releases are rejected.
+	 *
+	 */
+	err_line = 999;
+	TEST_CHECK(gs1_dict_store_load(store, release2, strlen(release2), &err_line) == NULL && err_line == 0);
+	TEST_CHECK(gs1_dict_store_load(store, "01 N14\n02 Q14\n", 14, &err_line) == NULL && err_line == 2);
+	TEST_CHECK(gs1_dict_store_load(store, "0", 1, NULL) == NULL);
+	TEST_CHECK(gs1_dict_store_load_file(store, "test-dict-missing.tmp", &err_line) == NULL && err_line == 0);
+	TEST_CHECK(gs1_dict_store_load_file(store, "test-dict-missing.tmp", NULL) == NULL);
+
+{
+	static const char *file = "test-dict.tmp";
+	FILE *fp;
+
+	fp = fopen(file, "wb");
+	TEST_ASSERT(fp != NULL);
+	fputs("# Release: 3\n01 N14\n", fp);
+	fclose(fp);
+	TEST_CHECK(gs1_dict_store_load_file(store, file, &err_line) != NULL);
+	remove(file);
+	TEST_CHECK(gs1_dict_store_find(store, "3") != NULL);
+}
+
+	gs1_dict_store_free(store);
+	gs1_dict_store_free(NULL);
+	gs1_dict_free(NULL);
+
+}
+
+
+void test_gs1_dict_store_arena(void)
+{
+
+	static store_align_t mem[131072 / sizeof(store_align_t)];
+	static const char many[] = "# Release: 4\n7000-7299 ? X..9\n";
+	gs1_arena_t arena;
+	gs1_dict_store_t *store;
+	const gs1_dict_t *dict;
+	size_t err_line, used;
+
+	gs1_arena_init(&arena, mem, sizeof(mem));
+
+	TEST_ASSERT((store = gs1_dict_store_new_arena(&arena)) != NULL);
+	TEST_ASSERT((dict = gs1_dict_store_load(store, test_dict, strlen(test_dict), &err_line)) != NULL);
+	TEST_CHECK(gs1_dict_num_entries(dict) == 18);
+	TEST_CHECK(gs1_dict_lookup(dict, "8008", 4)->num_components == 4);
+	TEST_CHECK(gs1_dict_store_find(store, "2026-01-27") == dict);
+	TEST_CHECK(gs1_dict_store_size(store) <= arena.used);
+	TEST_CHECK((unsigned char *)dict >= arena.base && (unsigned char *)dict < arena.base + arena.used);
+
+	/*
+	 * The memory is released only with the arena.
+	 *
+	 */
+	used = arena.used;
+	gs1_dict_store_free(store);
+	TEST_CHECK(arena.used == used);
+
+	gs1_arena_reset(&arena);
+	TEST_ASSERT((store = gs1_dict_store_new_arena(&arena)) != NULL);
+	TEST_CHECK(gs1_dict_store_load(store, test_dict, strlen(test_dict), NULL) != NULL);
+	TEST_CHECK(arena.used == used);
+
+	/*
+	 * Exhaustion of the arena at each point of the load is reported as a
+	 * failure to allocate memory.
+	 *
+	 */
+	for (arena.size = sizeof(gs1_dict_store_t); arena.size < used; arena.size += 8) {
+		gs1_arena_reset(&arena);
+		TEST_ASSERT((store = gs1_dict_store_new_arena(&arena)) != NULL);
+		err_line = 999;
+		TEST_CHECK(gs1_dict_store_load(store, test_dict, strlen(test_dict), &err_line) == NULL && err_line == 0);
+	}
+
+	/*
+	 * The index outgrows its initial working storage.
+	 *
+	 */
+	gs1_arena_init(&arena, mem, sizeof(mem));
+	TEST_ASSERT((store = gs1_dict_store_new_arena(&arena)) != NULL);
+	TEST_ASSERT((dict = gs1_dict_store_load(store, many, strlen(many), NULL)) != NULL);
+	TEST_CHECK(gs1_dict_num_entries(dict) == 300);
+	TEST_CHECK(gs1_dict_lookup(dict, "7299", 4) != NULL);
+
+	gs1_arena_init(&arena, mem, sizeof(gs1_dict_store_t) - 1);
+	TEST_CHECK(gs1_dict_store_new_arena(&arena) == NULL);
+
+}
+
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <pthread.h>
+
+static volatile long dict_readers_done;
+static volatile long dict_reader_errors;
+
+static void* dict_reader(void *arg)
+{
+
+	int i;
+
+	(void)arg;
+
+	for (i = 0; i < 2000; i++) {
+
+		gs1_lint_epoch_guard_t guard;
+		const gs1_dict_t *dict = gs1_dict_enter(&guard);
+		const gs1_dict_entry_t *entry = dict ? gs1_dict_lookup(dict, "3103", 4) : NULL;
+
+		GS1_LINTER_ATOMIC_ADD(&dict_reader_errors, dict && (!entry || strcmp(entry->title, "NET WEIGHT (kg)") != 0) ? 1 : 0);
+
+		gs1_dict_exit(&guard);
+
+	}
+
+	GS1_LINTER_ATOMIC_ADD(&dict_readers_done, 1);
+
+	return NULL;
+
+}
+
+#endif
+
+void test_gs1_dict_install(void)
+{
+
+	gs1_lint_epoch_guard_t guard, guard2;
+	gs1_dict_t *dict1, *dict2;
+	size_t err_line;
+
+	TEST_CHECK(gs1_dict_enter(&guard) == NULL);
+	gs1_dict_exit(&guard);
+
+	dict1 = test_load(test_dict, &err_line);
+	dict2 = test_load("# Release: 2\n01 N14\n", &err_line);
+	TEST_ASSERT(dict1 && dict2);
+
+	gs1_dict_install(dict1);
+	TEST_CHECK(gs1_dict_enter(&guard) == dict1);
+
+	/*
+	 * A reader keeps the dictionary that it entered with, and a nested
+	 * reader sees the replacement.
+	 *
+	 */
+	TEST_CHECK(GS1_LINTER_ATOMIC_XCHG_PTR(&current, dict2) == dict1);
+	TEST_CHECK(gs1_dict_enter(&guard2) == dict2);
+	TEST_CHECK(strcmp(gs1_dict_release(dict1), "2026-01-27") == 0);
+	gs1_dict_exit(&guard2);
+	gs1_dict_exit(&guard);
+	gs1_lint_epoch_synchronize();
+	gs1_dict_free(dict1);
+
+	TEST_CHECK(strcmp(gs1_dict_release(gs1_dict_enter(&guard)), "2") == 0);
+	gs1_dict_exit(&guard);
+
+	gs1_dict_install(NULL);
+	TEST_CHECK(gs1_dict_enter(&guard) == NULL);
+	gs1_dict_exit(&guard);
+
+#if defined(__unix__) || defined(__APPLE__)
+{
+	/*
+	 * Replace the dictionary repeatedly under concurrent readers.
+	 *
+	 */
+	pthread_t readers[4];
+	size_t i;
+
+	GS1_LINTER_ATOMIC_XCHG(&dict_readers_done, 0);
+	GS1_LINTER_ATOMIC_XCHG(&dict_reader_errors, 0);
+	for (i = 0; i < 4; i++)
+		TEST_ASSERT(pthread_create(&readers[i], NULL, dict_reader, NULL) == 0);
+
+	while (GS1_LINTER_ATOMIC_LOAD(&dict_readers_done) < 4)
+		gs1_dict_install(test_load(test_dict, &err_line));
+
+	for (i = 0; i < 4; i++)
+		TEST_ASSERT(pthread_join(readers[i], NULL) == 0);
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&dict_reader_errors) == 0);
+
+	gs1_dict_install(NULL);
+}
+#endif
+
+}
+
+#endif  /* UNIT_TESTS */
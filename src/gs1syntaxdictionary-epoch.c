@@ -0,0 +1,217 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-epoch.c
+ *
+ * @brief Epoch-based reclamation for tables that are replaced while other
+ * threads may be reading them.
+ *
+ * Readers bracket their use of a shared table with gs1_lint_epoch_enter() and
+ * gs1_lint_epoch_exit(). These never block and take no locks: each increments
+ * and later decrements a reader counter belonging to the current epoch.
+ *
+ * A writer first publishes the replacement table with an atomic pointer swap
+ * and then calls gs1_lint_epoch_synchronize(), which advances the epoch and
+ * waits until every reader that may have seen the old table has left its
+ * critical section. The old table may then be freed.
+ *
+ * Reader counters are striped across cache lines, with the stripe chosen from
+ * the reader's stack address, so that concurrent readers on different threads
+ * rarely contend on the same counter.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+#define GS1_LINTER_EPOCH_STRIPES_LOG2 4
+#define GS1_LINTER_EPOCH_STRIPES (1u << GS1_LINTER_EPOCH_STRIPES_LOG2)
+#define GS1_LINTER_CACHE_LINE 64
+
+
+static struct {
+	volatile long count;
+	char pad[GS1_LINTER_CACHE_LINE - sizeof(long)];
+} readers[2][GS1_LINTER_EPOCH_STRIPES];
+
+static volatile long epoch;
+static volatile long writer_lock;
+
+
+static void epoch_yield(void)
+{
+#ifdef _WIN32
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+
+/*
+ * Threads run on distinct stacks, so hashing the page of a stack address
+ * spreads concurrent readers across the counter stripes.
+ *
+ */
+static unsigned int epoch_stripe(const void* const p)
+{
+	const uint32_t h = (uint32_t)((uintptr_t)p >> 12) * UINT32_C(0x9E3779B1);
+	return (unsigned int)(h >> (32 - GS1_LINTER_EPOCH_STRIPES_LOG2));
+}
+
+
+/*
+ * Enter a read-side critical section.
+ *
+ * The counter for the observed epoch is incremented and the epoch is then
+ * re-read. If a writer advanced the epoch in the meantime then the reader
+ * backs out and tries again, so that a writer waiting on the old epoch's
+ * counters never misses a reader that could hold the old table.
+ *
+ */
+GS1_LINTER_INTERNAL void gs1_lint_epoch_enter(gs1_lint_epoch_guard_t* const guard)
+{
+
+	const unsigned int stripe = epoch_stripe(guard);
+	long e;
+
+	for (;;) {
+		e = GS1_LINTER_ATOMIC_LOAD(&epoch);
+		GS1_LINTER_ATOMIC_ADD(&readers[e & 1][stripe].count, 1);
+		if (GS1_LINTER_LIKELY(GS1_LINTER_ATOMIC_LOAD(&epoch) == e))
+			break;
+		GS1_LINTER_ATOMIC_ADD(&readers[e & 1][stripe].count, -1);	/* LCOV_EXCL_LINE */
+	}
+
+	guard->epoch = e;
+	guard->stripe = stripe;
+
+}
+
+
+/*
+ * Leave a read-side critical section.
+ *
+ */
+GS1_LINTER_INTERNAL void gs1_lint_epoch_exit(const gs1_lint_epoch_guard_t* const guard)
+{
+	GS1_LINTER_ATOMIC_ADD(&readers[guard->epoch & 1][guard->stripe].count, -1);
+}
+
+
+/*
+ * Wait until all readers that entered before the call have exited.
+ *
+ * Writers are serialised so that at most one epoch transition is pending;
+ * readers are never blocked.
+ *
+ */
+GS1_LINTER_INTERNAL void gs1_lint_epoch_synchronize(void)
+{
+
+	long old;
+	unsigned int i;
+
+	while (GS1_LINTER_ATOMIC_XCHG(&writer_lock, 1) != 0) epoch_yield();
+
+	old = GS1_LINTER_ATOMIC_ADD(&epoch, 1);
+	for (i = 0; i < GS1_LINTER_EPOCH_STRIPES; i++)
+		while (GS1_LINTER_ATOMIC_LOAD(&readers[old & 1][i].count) != 0) epoch_yield();
+
+	GS1_LINTER_ATOMIC_XCHG(&writer_lock, 0);
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <pthread.h>
+#include <time.h>
+
+static volatile long synchronized;
+
+static void* epoch_writer(void *arg)
+{
+	(void)arg;
+	gs1_lint_epoch_synchronize();
+	GS1_LINTER_ATOMIC_XCHG(&synchronized, 1);
+	return NULL;
+}
+
+#endif
+
+void test_gs1_lint_epoch(void)
+{
+
+	gs1_lint_epoch_guard_t g1, g2;
+
+	/*
+	 * Nested readers; synchronize returns immediately with no readers.
+	 *
+	 */
+	gs1_lint_epoch_enter(&g1);
+	gs1_lint_epoch_enter(&g2);
+	TEST_CHECK(g1.epoch == g2.epoch);
+	gs1_lint_epoch_exit(&g2);
+	gs1_lint_epoch_exit(&g1);
+
+	gs1_lint_epoch_synchronize();
+
+	gs1_lint_epoch_enter(&g2);
+	TEST_CHECK(g2.epoch == g1.epoch + 1);
+	gs1_lint_epoch_exit(&g2);
+
+#if defined(__unix__) || defined(__APPLE__)
+{
+	/*
+	 * A writer must wait for a reader that entered before it.
+	 *
+	 */
+	pthread_t writer;
+	const struct timespec delay = { 0, 50000000 };
+
+	GS1_LINTER_ATOMIC_XCHG(&synchronized, 0);
+	gs1_lint_epoch_enter(&g1);
+	TEST_ASSERT(pthread_create(&writer, NULL, epoch_writer, NULL) == 0);
+	nanosleep(&delay, NULL);
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&synchronized) == 0);
+	gs1_lint_epoch_exit(&g1);
+	TEST_ASSERT(pthread_join(writer, NULL) == 0);
+	TEST_CHECK(GS1_LINTER_ATOMIC_LOAD(&synchronized) == 1);
+}
+#endif
+
+}
+
+#endif  /* UNIT_TESTS */
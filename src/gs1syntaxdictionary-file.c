@@ -0,0 +1,72 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-file.c
+ *
+ * @brief Reading of files for the loaders of the Syntax Dictionary and the
+ * code lists.
+ *
+ * Kept apart from the library core and the linters so that, as built for the
+ * minimal profile, they perform no file I/O.
+ *
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ * Read the entire contents of a file into a newly allocated buffer that the
+ * caller must free.
+ *
+ * Returns NULL if the file cannot be read or is larger than max_len.
+ *
+ */
+GS1_LINTER_INTERNAL char* gs1_lint_read_file(const char* const path, const size_t max_len, size_t* const len)
+{
+
+	FILE *fp;
+	char *buf;
+	long size;
+
+	fp = fopen(path, "rb");
+	if (!fp)
+		return NULL;
+
+	if (fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) < 0 || (size_t)size > max_len ||
+	    fseek(fp, 0, SEEK_SET) != 0 || (buf = (char *)malloc((size_t)size + 1)) == NULL) {
+		fclose(fp);
+		return NULL;
+	}
+
+	*len = fread(buf, 1, (size_t)size, fp);
+	fclose(fp);
+
+	if (*len != (size_t)size) {		// File truncated while being read
+		free(buf);			/* LCOV_EXCL_LINE */
+		return NULL;			/* LCOV_EXCL_LINE */
+	}
+
+	return buf;
+
+}
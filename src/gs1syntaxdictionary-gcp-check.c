@@ -0,0 +1,89 @@
+/**
+ * GS1 Barcode Syntax Dictionary
+ *
+ * @author Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Check the gcppos1 linter, as built with a header generated by
+ * gs1syntaxdictionary-gcp-gen, against the expected results. Used by
+ * "make gcp-gen-test".
+ *
+ * Usage:
+ *
+ *     gs1syntaxdictionary-gcp-check < cases.txt
+ *
+ * Each line of the input contains the data to be linted, a space and "1" if
+ * the data starts with a listed GCP or "0" if it does not. Blank lines and
+ * lines beginning with "#" are ignored.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+
+
+#define MAX_LINE 256
+
+
+int main(void)
+{
+
+	char line[MAX_LINE];
+	size_t line_no = 0, cases = 0, failures = 0;
+
+	while (fgets(line, sizeof(line), stdin)) {
+
+		size_t len = strlen(line);
+		char *sep;
+		gs1_lint_err_t err;
+		int expected;
+
+		line_no++;
+
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+			line[--len] = '\0';
+
+		if (len == 0 || line[0] == '#')
+			continue;
+
+		sep = strrchr(line, ' ');
+		if (!sep || (strcmp(sep + 1, "0") != 0 && strcmp(sep + 1, "1") != 0)) {
+			fprintf(stderr, "Line %zu: Expected data followed by 0 or 1: %s\n", line_no, line);
+			return EXIT_FAILURE;
+		}
+		expected = sep[1] == '1';
+		*sep = '\0';
+
+		err = gs1_lint_gcppos1(line, (size_t)(sep - line), NULL, NULL);
+		if ((err == GS1_LINTER_OK) != expected) {
+			fprintf(stderr, "Line %zu: %s: Expected %s GCP, got error %d\n",
+				line_no, line, expected ? "a" : "no", (int)err);
+			failures++;
+		}
+		cases++;
+
+	}
+
+	printf("%zu cases, %zu failures\n", cases, failures);
+
+	return failures == 0 && cases > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
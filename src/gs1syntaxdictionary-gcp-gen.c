@@ -0,0 +1,368 @@
+/**
+ * GS1 Barcode Syntax Dictionary
+ *
+ * @author Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Generate a header suitable for use as GS1_LINTER_CUSTOM_GCP_LOOKUP_H that
+ * validates GS1 Company Prefixes against a fixed list, compiled into the
+ * linters as static tables, for devices that have no filesystem or network.
+ *
+ * Usage:
+ *
+ *     gs1syntaxdictionary-gcp-gen [prefixes.txt] > gcp-lookup.h
+ *
+ * The input contains one GCP per line, as between 4 and 12 digits. Blank
+ * lines and lines beginning with "#" are ignored. UPC Company Prefixes and
+ * GS1-8 Prefixes must be given in the normalised form that is presented to
+ * the lookup by the gcppos1 linter, i.e. prefixed with "0" or "00000".
+ *
+ * The prefixes are held as a trie over the digits 0-9 that is compressed as
+ * follows:
+ *
+ *   - A prefix that extends another is dropped, since data that starts with
+ *     the longer prefix also starts with the shorter one.
+ *   - A complete prefix is not a node at all, but a bit in its parent.
+ *
+ * Each remaining node is a 20-bit word giving the digits that complete a
+ * prefix (leaf bits, digit 0 first) followed by the digits that lead to a
+ * further node (inner bits, digit 0 first). Nodes are stored in
+ * breadth-first order, so the children of a node are contiguous and are
+ * located from the index of the first child and the count of inner bits for
+ * lower digits.
+ *
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define GCP_MIN_LENGTH 4	// Keep aligned with instance in lint_gcppos1.c
+#define GCP_MAX_LENGTH 12
+#define MAX_LINE 256
+
+
+struct node_s {
+	size_t child[10];	// Index of child node, or 0 for none
+	bool complete;		// A prefix ends at this node
+};
+
+static struct node_s *nodes;
+static size_t nodes_num, nodes_cap;
+
+
+static size_t node_new(void)
+{
+
+	if (nodes_num == nodes_cap) {
+		const size_t cap = nodes_cap ? nodes_cap * 2 : 1024;
+		struct node_s *n = (struct node_s *)realloc(nodes, cap * sizeof(struct node_s));
+		if (!n) {
+			fprintf(stderr, "Out of memory\n");
+			exit(EXIT_FAILURE);
+		}
+		nodes = n;
+		nodes_cap = cap;
+	}
+
+	memset(&nodes[nodes_num], 0, sizeof(struct node_s));
+	return nodes_num++;
+
+}
+
+
+static void insert(const char* const gcp, const size_t len)
+{
+
+	size_t i, n = 0;
+
+	for (i = 0; i < len; i++) {
+		const size_t d = (size_t)(gcp[i] - '0');
+		if (nodes[n].complete)
+			return;			// Already covered by a shorter prefix
+		if (!nodes[n].child[d]) {
+			const size_t c = node_new();
+			nodes[n].child[d] = c;
+		}
+		n = nodes[n].child[d];
+	}
+
+	nodes[n].complete = true;
+	memset(nodes[n].child, 0, sizeof(nodes[n].child));
+
+}
+
+
+/*
+ * Compute the 20-bit word for a node: leaf bits for digits 0-9 in bits 19-10
+ * and inner bits for digits 0-9 in bits 9-0.
+ *
+ */
+static uint32_t node_word(const size_t n)
+{
+
+	uint32_t w = 0;
+	size_t d;
+
+	for (d = 0; d < 10; d++) {
+		const size_t c = nodes[n].child[d];
+		if (!c)
+			continue;
+		if (nodes[c].complete)
+			w |= UINT32_C(1) << (19 - d);
+		else
+			w |= UINT32_C(1) << (9 - d);
+	}
+
+	return w;
+
+}
+
+
+struct queued_s {
+	size_t node;
+	size_t first;
+	uint32_t word;
+	char prefix[GCP_MAX_LENGTH + 1];
+};
+
+
+static bool read_prefixes(FILE* const fp, size_t* const count)
+{
+
+	char line[MAX_LINE];
+	size_t line_no = 0;
+
+	*count = 0;
+
+	while (fgets(line, sizeof(line), fp)) {
+
+		size_t len = strlen(line), i;
+
+		line_no++;
+
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r' ||
+				   line[len - 1] == ' ' || line[len - 1] == '\t'))
+			line[--len] = '\0';
+
+		if (len == 0 || line[0] == '#')
+			continue;
+
+		for (i = 0; i < len && line[i] >= '0' && line[i] <= '9'; i++)
+			;
+		if (i != len || len < GCP_MIN_LENGTH || len > GCP_MAX_LENGTH) {
+			fprintf(stderr, "Line %zu: Expected a GCP of %d to %d digits: %s\n",
+				line_no, GCP_MIN_LENGTH, GCP_MAX_LENGTH, line);
+			return false;
+		}
+
+		insert(line, len);
+		(*count)++;
+
+	}
+
+	if (ferror(fp)) {
+		fprintf(stderr, "Error reading input\n");
+		return false;
+	}
+
+	return true;
+
+}
+
+
+static void print_binary(const uint32_t w)
+{
+	int b;
+	printf("0b");
+	for (b = 19; b >= 0; b--)
+		putchar(w & (UINT32_C(1) << b) ? '1' : '0');
+}
+
+
+int main(int argc, char *argv[])
+{
+
+	FILE *fp = stdin;
+	struct queued_s *q;
+	size_t q_num, i, count;
+	bool ok;
+	const char *index_type;
+	size_t index_size;
+
+	if (argc > 2 || (argc == 2 && argv[1][0] == '-' && argv[1][1] != '\0')) {
+		fprintf(stderr, "Usage: %s [prefixes.txt] > gcp-lookup.h\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "-") != 0) {
+		fp = fopen(argv[1], "r");
+		if (!fp) {
+			fprintf(stderr, "Cannot open %s\n", argv[1]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	node_new();	// Root
+	ok = read_prefixes(fp, &count);
+	if (fp != stdin)
+		fclose(fp);
+	if (!ok)
+		return EXIT_FAILURE;
+
+	/*
+	 * Lay out the incomplete nodes in breadth-first order.
+	 *
+	 */
+	q = (struct queued_s *)calloc(nodes_num, sizeof(struct queued_s));
+	if (!q) {
+		fprintf(stderr, "Out of memory\n");
+		return EXIT_FAILURE;
+	}
+
+	q[0].node = 0;
+	q_num = 1;
+	for (i = 0; i < q_num; i++) {
+		size_t d;
+		q[i].word = node_word(q[i].node);
+		q[i].first = q_num;
+		for (d = 0; d < 10; d++) {
+			const size_t c = nodes[q[i].node].child[d];
+			if (!c || nodes[c].complete)
+				continue;
+			q[q_num].node = c;
+			memcpy(q[q_num].prefix, q[i].prefix, GCP_MAX_LENGTH);
+			q[q_num].prefix[strlen(q[i].prefix)] = (char)('0' + d);
+			q_num++;
+		}
+	}
+
+	if (q_num <= UINT16_MAX) {
+		index_type = "uint16_t";
+		index_size = 2;
+	} else {
+		index_type = "uint32_t";
+		index_size = 4;
+	}
+
+	printf("/*\n");
+	printf(" * GS1 Company Prefix lookup generated by gs1syntaxdictionary-gcp-gen.\n");
+	printf(" *\n");
+	printf(" * Build the linters with -DGS1_LINTER_CUSTOM_GCP_LOOKUP_H=<this file>.\n");
+	printf(" *\n");
+	printf(" * Prefixes read: %zu\n", count);
+	printf(" * Trie nodes:    %zu\n", q_num);
+	printf(" * Table size:    %zu bytes\n", q_num * (4 + index_size));
+	printf(" *\n");
+	printf(" * DO NOT EDIT. Regenerate from the list of prefixes instead.\n");
+	printf(" *\n");
+	printf(" */\n");
+	printf("\n");
+	printf("#ifndef GS1_LINTER_GCP_LOOKUP_H\n");
+	printf("#define GS1_LINTER_GCP_LOOKUP_H\n");
+	printf("\n");
+	printf("#include <stddef.h>\n");
+	printf("#include <stdint.h>\n");
+	printf("\n");
+	printf("\n");
+	printf("/*\n");
+	printf(" *  Trie nodes in breadth-first order. Bits 19-10 are set for the digits 0-9\n");
+	printf(" *  that complete a GCP; bits 9-0 for the digits 0-9 that lead to a child node.\n");
+	printf(" *\n");
+	printf(" */\n");
+	printf("static const uint32_t gs1_lint_gcp_trie[] = {\n");
+	printf("#if __STDC_VERSION__ >= 202311L\n");
+	for (i = 0; i < q_num; i++) {
+		printf("\t");
+		print_binary(q[i].word);
+		printf(",  // %zu: \"%s\"\n", i, q[i].prefix);
+	}
+	printf("#else\n");
+	printf("\t/*\n");
+	printf("\t *  Fallback for compilers lacking binary literal support.\n");
+	printf("\t *\n");
+	printf("\t */\n");
+	for (i = 0; i < q_num; i++)
+		printf("%s0x%05" PRIx32 ",%s", i % 8 == 0 ? "\t" : "", q[i].word, i % 8 == 7 || i == q_num - 1 ? "\n" : " ");
+	printf("#endif\n");
+	printf("};\n");
+	printf("\n");
+	printf("/*\n");
+	printf(" *  Index of the first child of each node.\n");
+	printf(" *\n");
+	printf(" */\n");
+	printf("static const %s gs1_lint_gcp_trie_first[] = {\n", index_type);
+	for (i = 0; i < q_num; i++)
+		printf("%s%zu,%s", i % 16 == 0 ? "\t" : "", q[i].first, i % 16 == 15 || i == q_num - 1 ? "\n" : " ");
+	printf("};\n");
+	printf("\n");
+	printf("\n");
+	printf("static int gs1_lint_gcp_trie_lookup(const char* const data, const size_t data_len)\n");
+	printf("{\n");
+	printf("\n");
+	printf("\tsize_t i, n = 0;\n");
+	printf("\n");
+	printf("\tfor (i = 0; i < data_len; i++) {\n");
+	printf("\n");
+	printf("\t\tconst unsigned int d = (unsigned int)(data[i] - '0');\n");
+	printf("\t\tuint32_t w, below;\n");
+	printf("\n");
+	printf("\t\tif (d > 9)\n");
+	printf("\t\t\treturn 0;\n");
+	printf("\n");
+	printf("\t\tw = gs1_lint_gcp_trie[n];\n");
+	printf("\t\tif (w & (UINT32_C(1) << (19 - d)))\n");
+	printf("\t\t\treturn 1;\n");
+	printf("\t\tif (!(w & (UINT32_C(1) << (9 - d))))\n");
+	printf("\t\t\treturn 0;\n");
+	printf("\n");
+	printf("\t\t/*\n");
+	printf("\t\t *  The child is preceded by one sibling for each inner bit of a\n");
+	printf("\t\t *  lower digit.\n");
+	printf("\t\t *\n");
+	printf("\t\t */\n");
+	printf("\t\tbelow = (w & UINT32_C(0x3ff)) >> (10 - d);\n");
+	printf("\t\tbelow = below - ((below >> 1) & UINT32_C(0x55555555));\n");
+	printf("\t\tbelow = (below & UINT32_C(0x33333333)) + ((below >> 2) & UINT32_C(0x33333333));\n");
+	printf("\t\tbelow = (below + (below >> 4)) & UINT32_C(0x0f0f0f0f);\n");
+	printf("\t\tbelow = (below + (below >> 8)) & UINT32_C(0x1f);\n");
+	printf("\t\tn = (size_t)gs1_lint_gcp_trie_first[n] + below;\n");
+	printf("\n");
+	printf("\t}\n");
+	printf("\n");
+	printf("\treturn 0;\n");
+	printf("\n");
+	printf("}\n");
+	printf("\n");
+	printf("#define GS1_LINTER_CUSTOM_GCP_LOOKUP(data, data_len, valid, offline) do {\t\\\n");
+	printf("\tvalid = gs1_lint_gcp_trie_lookup(data, data_len);\t\t\t\\\n");
+	printf("\toffline = 0;\t\t\t\t\t\t\t\t\\\n");
+	printf("} while (0)\n");
+	printf("\n");
+	printf("#endif  /* GS1_LINTER_GCP_LOOKUP_H */\n");
+
+	free(q);
+	free(nodes);
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,285 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-input.c
+ *
+ * @brief Identification of the data received from a scanner.
+ *
+ * Scanners commonly prefix the data with an AIM symbology identifier, "]"
+ * followed by a symbology character and a modifier character, which tells
+ * whether the symbol carried a GS1 element string. gs1_input_identify()
+ * inspects only the first few characters to determine where the payload
+ * starts and what it is, so that gs1_message_scan_input() can pass an
+ * element string to gs1_message_scan() in place, without first stripping the
+ * identifier into a copy.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ *  AIM symbology identifiers of the symbols that carry a GS1 element string.
+ *
+ */
+static const char input_gs1_ids[][2] = {
+	{ 'C', '1' },		// GS1-128
+	{ 'e', '0' },		// GS1 DataBar
+	{ 'd', '2' },		// GS1 DataMatrix
+	{ 'Q', '3' },		// GS1 QR Code
+	{ 'J', '1' },		// GS1 DotCode
+};
+
+
+/*
+ *  Whether the data starts with a URI scheme for a GS1 Digital Link, ignoring
+ *  the case of the scheme as RFC 3986 requires.
+ *
+ */
+static bool input_is_uri(const char* const data, const size_t data_len)
+{
+
+	static const char scheme[] = "https://";
+	size_t i, j;
+
+	for (i = 0, j = 0; j < sizeof(scheme) - 1; i++, j++) {
+		if (i == data_len)
+			return false;
+		if (j == 4 && data[i] == ':')		// "http://"
+			j++;
+		if ((j < 5 ? (char)(data[i] | 0x20) : data[i]) != scheme[j])
+			return false;
+	}
+
+	return true;
+
+}
+
+
+/**
+ * Identify the data received from a scanner by its AIM symbology identifier,
+ * if any.
+ *
+ * The symbologies that carry a GS1 element string are identified by "]C1"
+ * (GS1-128), "]e0" (GS1 DataBar), "]d2" (GS1 DataMatrix), "]Q3" (GS1 QR Code)
+ * and "]J1" (GS1 DotCode). Their payload is an element string with FNC1
+ * transmitted as #GS1_INPUT_FNC1 and the leading FNC1 omitted.
+ *
+ * Otherwise the payload is a GS1 Digital Link URI if it begins with "http://"
+ * or "https://", in which case it is expected to have been carried by a plain
+ * DataMatrix or QR Code symbol ("]d1" or "]Q1"). Data without a symbology
+ * identifier is taken to be an element string only if it begins with
+ * #GS1_INPUT_FNC1.
+ *
+ * @param [out] input Receives the identification. Must not be `NULL`.
+ * @param [in] data The data received from the scanner. Must not be `NULL`.
+ * @param [in] data_len Length of the data.
+ *
+ * @return the kind of the payload, which is also held in `input->kind`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_input_kind_t gs1_input_identify(gs1_input_t* const input, const char* const data, const size_t data_len)
+{
+
+	size_t i;
+
+	assert(input);
+	assert(data);
+
+	input->kind = GS1_INPUT_UNRECOGNISED;
+	input->symbology = 0;
+	input->modifier = 0;
+	input->payload_pos = 0;
+
+	if (data_len >= 3 && data[0] == ']') {
+
+		input->symbology = data[1];
+		input->modifier = data[2];
+		input->payload_pos = 3;
+
+		for (i = 0; i < sizeof(input_gs1_ids) / sizeof(input_gs1_ids[0]); i++) {
+			if (data[1] == input_gs1_ids[i][0] && data[2] == input_gs1_ids[i][1]) {
+				input->kind = GS1_INPUT_ELEMENT_STRING;
+				return input->kind;
+			}
+		}
+
+	}
+	else if (data_len > 0 && data[0] == GS1_INPUT_FNC1) {
+		input->kind = GS1_INPUT_ELEMENT_STRING;
+		return input->kind;
+	}
+
+	if (input_is_uri(data + input->payload_pos, data_len - input->payload_pos))
+		input->kind = GS1_INPUT_DIGITAL_LINK;
+
+	return input->kind;
+
+}
+
+
+/**
+ * Validate the data received from a scanner as an element string.
+ *
+ * The data is identified with gs1_input_identify() and, if its payload is an
+ * element string, it is scanned in place with gs1_message_scan(). The offsets
+ * recorded in `msg` are then relative to the start of the payload, i.e.
+ * `data + input->payload_pos`.
+ *
+ * @param [out] msg The message to receive the result. Must not be `NULL`.
+ * @param [in] dict The Syntax Dictionary, e.g. from gs1_dict_enter(). Must not
+ *                  be `NULL`.
+ * @param [in] data The data received from the scanner. Must not be `NULL`.
+ * @param [in] data_len Length of the data.
+ * @param [out] input Receives the identification of the data. Must not be
+ *                    `NULL`.
+ *
+ * @return #GS1_MESSAGE_NOT_ELEMENT_STRING if the payload is not an element
+ *         string, e.g. when it is a GS1 Digital Link URI, otherwise as
+ *         gs1_message_scan()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan_input(gs1_message_t* const msg, const gs1_dict_t* const dict, const char* const data, const size_t data_len, gs1_input_t* const input)
+{
+
+	assert(msg);
+	assert(dict);
+	assert(data);
+	assert(input);
+
+	if (gs1_input_identify(input, data, data_len) != GS1_INPUT_ELEMENT_STRING) {
+		gs1_message_reset(msg);
+		msg->err = GS1_MESSAGE_NOT_ELEMENT_STRING;
+		return msg->err;
+	}
+
+	return gs1_message_scan(msg, dict, data + input->payload_pos, data_len - input->payload_pos, GS1_INPUT_FNC1);
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#include <string.h>
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+static gs1_input_kind_t test_identify(gs1_input_t* const input, const char* const data)
+{
+	return gs1_input_identify(input, data, strlen(data));
+}
+
+void test_gs1_input_identify(void)
+{
+
+	gs1_input_t input;
+
+	TEST_CHECK(test_identify(&input, "]C1010950110153000310ABC") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(input.symbology == 'C' && input.modifier == '1' && input.payload_pos == 3);
+	TEST_CHECK(test_identify(&input, "]e00109501101530003") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(test_identify(&input, "]d2010950110153000310ABC\x1D" "91X") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(test_identify(&input, "]Q3010950110153000310ABC") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(test_identify(&input, "]J1010950110153000310ABC") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(test_identify(&input, "]d2") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(input.payload_pos == 3);
+
+	TEST_CHECK(test_identify(&input, "\x1D" "010950110153000310ABC") == GS1_INPUT_ELEMENT_STRING);
+	TEST_CHECK(input.symbology == 0 && input.payload_pos == 0);
+
+	/*
+	 *  A GS1 Digital Link URI, with or without a symbology identifier.
+	 *
+	 */
+	TEST_CHECK(test_identify(&input, "]Q1https://id.gs1.org/01/09501101530003") == GS1_INPUT_DIGITAL_LINK);
+	TEST_CHECK(input.symbology == 'Q' && input.modifier == '1' && input.payload_pos == 3);
+	TEST_CHECK(test_identify(&input, "]d1HTTP://example.com/01/09501101530003") == GS1_INPUT_DIGITAL_LINK);
+	TEST_CHECK(test_identify(&input, "https://id.gs1.org/01/09501101530003") == GS1_INPUT_DIGITAL_LINK);
+	TEST_CHECK(input.symbology == 0 && input.payload_pos == 0);
+	TEST_CHECK(test_identify(&input, "http://") == GS1_INPUT_DIGITAL_LINK);
+
+	/*
+	 *  Anything else.
+	 *
+	 */
+	TEST_CHECK(test_identify(&input, "]C0ABC") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(input.symbology == 'C' && input.modifier == '0' && input.payload_pos == 3);
+	TEST_CHECK(test_identify(&input, "]E00950110153000") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "010950110153000310ABC") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "]C") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(input.symbology == 0 && input.payload_pos == 0);
+	TEST_CHECK(test_identify(&input, "") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "http:/") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "https:x") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "ftp://example.com") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "http;//example.com") == GS1_INPUT_UNRECOGNISED);
+	TEST_CHECK(test_identify(&input, "http\x1A//example.com") == GS1_INPUT_UNRECOGNISED);
+
+}
+
+void test_gs1_message_scan_input(void)
+{
+
+	static const char dict_data[] =
+		"# Release: 2026-01-27\n"
+		"01        *?  N14,csum\n"
+		"10         ?  X..20\n"
+		"91         ?  X..90\n";
+
+	static const char data[] = "]d2010950110153000310ABC\x1D" "91XYZ";
+	gs1_dict_t *dict;
+	gs1_message_t msg;
+	gs1_input_t input;
+	size_t err_line;
+
+	dict = gs1_dict_load(dict_data, strlen(dict_data), &err_line);
+	TEST_ASSERT(dict != NULL);
+
+	/*
+	 *  Offsets are relative to the payload.
+	 *
+	 */
+	TEST_CHECK(gs1_message_scan_input(&msg, dict, data, strlen(data), &input) == GS1_MESSAGE_OK);
+	TEST_CHECK(input.kind == GS1_INPUT_ELEMENT_STRING);
+	TEST_ASSERT(msg.num_ais == 3);
+	TEST_CHECK(strcmp(msg.ai[1]->ai, "10") == 0);
+	TEST_CHECK(memcmp(data + input.payload_pos + msg.value_pos[1], "ABC", 3) == 0 && msg.value_len[1] == 3);
+	TEST_CHECK(memcmp(data + input.payload_pos + msg.value_pos[2], "XYZ", 3) == 0);
+
+	TEST_CHECK(gs1_message_scan_input(&msg, dict, "]C10109501101530009", 19, &input) == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INCORRECT_CHECK_DIGIT && msg.err_pos == 15);
+
+	TEST_CHECK(gs1_message_scan_input(&msg, dict, "\x1D" "0109501101530003", 17, &input) == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.num_ais == 1);
+
+	TEST_CHECK(gs1_message_scan_input(&msg, dict, "]Q1https://id.gs1.org/01/09501101530003", 40, &input) == GS1_MESSAGE_NOT_ELEMENT_STRING);
+	TEST_CHECK(input.kind == GS1_INPUT_DIGITAL_LINK);
+	TEST_CHECK(msg.err == GS1_MESSAGE_NOT_ELEMENT_STRING && msg.num_ais == 0);
+
+	gs1_dict_free(dict);
+
+}
+
+#endif  /* UNIT_TESTS */
@@ -0,0 +1,1065 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-message.c
+ *
+ * @brief Validation of a complete element string against a loaded Syntax
+ * Dictionary, recording where each AI and component lies.
+ *
+ * The element string is split into AIs using the dictionary, each AI value
+ * is split into its components, and each component is checked against its
+ * length, character set and linters. The result is a gs1_message_t holding
+ * parallel arrays of offsets into the caller's buffer, so later stages can
+ * read the fields without copying them.
+ *
+ * A consumer that needs only a few AIs can use gs1_message_scan_select(),
+ * which delimits the other AIs without checking them.
+ *
+ * Input that arrives one character at a time, such as from a keyboard wedge
+ * scanner, can instead be validated as it arrives with
+ * gs1_message_stream_feed(), which reports an error as soon as it is certain.
+ *
+ * A gs1_message_t has a fixed capacity and no memory is allocated, so a
+ * scanning application can keep one per thread and reuse it for every
+ * element string.
+ *
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ *  The linter that enforces the character set of a component.
+ *
+ */
+static gs1_linter_t message_cset_linter(const char cset)
+{
+	switch (cset) {
+	case 'N': return gs1_lint_csetnumeric;
+	case 'Y': return gs1_lint_cset39;
+	case 'Z': return gs1_lint_cset64;
+	default:  return gs1_lint_cset82;
+	}
+}
+
+
+static gs1_message_err_t message_fail(gs1_message_t* const msg, const gs1_message_err_t err, const size_t pos, const size_t len)
+{
+	msg->err = err;
+	msg->err_pos = (uint16_t)pos;
+	msg->err_len = (uint16_t)len;
+	return err;
+}
+
+
+/**
+ * Clear a message so that it holds no AIs.
+ *
+ * Only the counts and the outcome are reset, so this is cheap enough to call
+ * before every scan. gs1_message_scan() does so itself.
+ *
+ * @param [out] msg The message to reset. Must not be `NULL`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_message_reset(gs1_message_t* const msg)
+{
+
+	assert(msg);
+
+	msg->num_ais = 0;
+	msg->num_components = 0;
+	msg->err = GS1_MESSAGE_OK;
+	msg->lint_err = GS1_LINTER_OK;
+	msg->err_pos = 0;
+	msg->err_len = 0;
+	msg->component_first[0] = 0;
+
+}
+
+
+/*
+ *  Scan an element string, recording all AIs or only those whose dictionary
+ *  entries are in `select`.
+ *
+ */
+static gs1_message_err_t message_scan(gs1_message_t* const msg, const gs1_dict_t* const dict, const char* const data, const size_t data_len, const char fnc1, const bool all, const gs1_dict_entry_t* const* const select, const size_t num_select)
+{
+
+	const char *p = data;
+	const char* const end = data + data_len;
+	uint16_t c = 0;
+
+	gs1_message_reset(msg);
+
+	if (GS1_LINTER_UNLIKELY(data_len > UINT16_MAX))
+		return message_fail(msg, GS1_MESSAGE_TOO_LONG, 0, 0);
+
+	if (p < end && *p == fnc1)
+		p++;
+
+	while (p < end) {
+
+		const gs1_dict_entry_t *e = NULL;
+		const char *v, *v_end;
+		const uint16_t n = msg->num_ais;
+		size_t ai_len;
+		unsigned int k;
+		bool selected;
+
+		for (ai_len = 2; !e && ai_len <= 4 && ai_len <= (size_t)(end - p); ai_len++)
+			e = gs1_dict_lookup(dict, p, ai_len);
+		if (GS1_LINTER_UNLIKELY(!e))
+			return message_fail(msg, GS1_MESSAGE_UNKNOWN_AI, (size_t)(p - data), (size_t)(end - p) < 4 ? (size_t)(end - p) : 4);
+
+		selected = all;
+		for (k = 0; !selected && k < num_select; k++)
+			selected = select[k] == e;
+
+		if (GS1_LINTER_UNLIKELY(selected && n == GS1_MESSAGE_MAX_AIS))
+			return message_fail(msg, GS1_MESSAGE_TOO_MANY_AIS, (size_t)(p - data), (size_t)(end - p));
+
+		v = p + strlen(e->ai);
+
+		/*
+		 *  AIs with predefined length are not terminated by FNC1.
+		 *
+		 */
+		if (e->flags & GS1_DICT_FLAG_NO_FNC1) {
+			size_t fixed = 0;
+			for (k = 0; k < e->num_components; k++)
+				fixed += e->components[k].max;
+			if (GS1_LINTER_UNLIKELY((size_t)(end - v) < fixed))
+				return message_fail(msg, GS1_MESSAGE_TRUNCATED_VALUE, (size_t)(v - data), (size_t)(end - v));
+			v_end = v + fixed;
+		} else {
+			v_end = (const char *)memchr(v, fnc1, (size_t)(end - v));
+			if (!v_end)
+				v_end = end;
+		}
+
+		/*
+		 *  An AI that is not selected is skipped unchecked.
+		 *
+		 */
+		if (!selected) {
+			p = v_end < end && *v_end == fnc1 ? v_end + 1 : v_end;
+			continue;
+		}
+
+		msg->ai[n] = e;
+		msg->value_pos[n] = (uint16_t)(v - data);
+		msg->value_len[n] = (uint16_t)(v_end - v);
+
+		for (k = 0; k < e->num_components; k++) {
+
+			const gs1_dict_component_t* const comp = &e->components[k];
+			const size_t left = (size_t)(v_end - v);
+			const size_t len = comp->min == comp->max ? comp->max : left < comp->max ? left : comp->max;
+			gs1_lint_err_t ret;
+			size_t pos = 0, plen = 0;
+			unsigned int l;
+
+			if (left == 0 && comp->optional)
+				break;
+
+			if (GS1_LINTER_UNLIKELY(len > left || len < comp->min))
+				return message_fail(msg, GS1_MESSAGE_INVALID_COMPONENT_LENGTH, (size_t)(v - data), left);
+
+			ret = message_cset_linter(comp->cset)(v, len, &pos, &plen);
+			for (l = 0; ret == GS1_LINTER_OK && l < comp->num_linters; l++)
+				ret = comp->linters[l](v, len, &pos, &plen);
+			if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK)) {
+				msg->lint_err = ret;
+				return message_fail(msg, GS1_MESSAGE_LINT_FAILED, (size_t)(v - data) + pos, plen);
+			}
+
+			msg->component_pos[c] = (uint16_t)(v - data);
+			msg->component_len[c] = (uint16_t)len;
+			c++;
+			v += len;
+
+		}
+
+		if (GS1_LINTER_UNLIKELY(v != v_end))
+			return message_fail(msg, GS1_MESSAGE_INVALID_COMPONENT_LENGTH, (size_t)(v - data), (size_t)(v_end - v));
+
+		msg->component_first[n + 1] = c;
+		msg->num_components = c;
+		msg->num_ais = (uint16_t)(n + 1);
+
+		p = v_end < end && *v_end == fnc1 ? v_end + 1 : v_end;
+
+	}
+
+	return GS1_MESSAGE_OK;
+
+}
+
+
+/**
+ * Validate an unbracketed element string against a Syntax Dictionary,
+ * recording the location of each AI value and each of its components.
+ *
+ * The AIs are identified using the dictionary. An AI with a predefined length
+ * ends after that length; any other AI ends at the next FNC1 or at the end of
+ * the data. Each component is checked for length, then with the linter for
+ * its character set, then with each of its linters in turn, stopping at the
+ * first failure.
+ *
+ * If the element string is not valid then the AIs that precede the one in
+ * error remain recorded, and `err`, `lint_err`, `err_pos` and `err_len`
+ * describe the failure.
+ *
+ * @param [out] msg The message to receive the result. Must not be `NULL`. Any
+ *                  previous contents are discarded.
+ * @param [in] dict The Syntax Dictionary, e.g. from gs1_dict_enter(). Must not
+ *                  be `NULL`.
+ * @param [in] data The element string. It must remain available for as long
+ *                  as the offsets in `msg` are used.
+ * @param [in] data_len Length of the element string.
+ * @param [in] fnc1 The character representing FNC1 in `data`, e.g. `'\x1D'`
+ *                  (GS). A leading FNC1 is ignored.
+ *
+ * @return #GS1_MESSAGE_OK if the element string is valid, otherwise the
+ *         reason that it is not, which is also held in `msg->err`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan(gs1_message_t* const msg, const gs1_dict_t* const dict, const char* const data, const size_t data_len, const char fnc1)
+{
+
+	assert(msg);
+	assert(dict);
+	assert(data || data_len == 0);
+
+	return message_scan(msg, dict, data, data_len, fnc1, true, NULL, 0);
+
+}
+
+
+/**
+ * Validate only selected AIs of an unbracketed element string against a
+ * Syntax Dictionary, recording the location of each selected AI value and
+ * each of its components.
+ *
+ * As gs1_message_scan(), except that an AI whose entry is not among those
+ * selected is only delimited, using its predefined length or the next FNC1,
+ * and is neither checked nor recorded. The AIs that are present must still
+ * all be known to the dictionary.
+ *
+ * @param [out] msg The message to receive the selected AIs. Must not be
+ *                  `NULL`. Any previous contents are discarded.
+ * @param [in] dict The Syntax Dictionary, e.g. from gs1_dict_enter(). Must not
+ *                  be `NULL`.
+ * @param [in] data The element string. It must remain available for as long
+ *                  as the offsets in `msg` are used.
+ * @param [in] data_len Length of the element string.
+ * @param [in] fnc1 The character representing FNC1 in `data`, e.g. `'\x1D'`
+ *                  (GS). A leading FNC1 is ignored.
+ * @param [in] select The entries of the AIs to validate and record, as
+ *                    returned by gs1_dict_lookup() on `dict`. May be `NULL`
+ *                    only if `num_select` is 0.
+ * @param [in] num_select Number of entries in `select`.
+ *
+ * @return #GS1_MESSAGE_OK if the selected AIs are valid and the remainder of
+ *         the element string can be delimited, otherwise the reason that it
+ *         cannot, which is also held in `msg->err`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan_select(gs1_message_t* const msg, const gs1_dict_t* const dict, const char* const data, const size_t data_len, const char fnc1, const gs1_dict_entry_t* const* const select, const size_t num_select)
+{
+
+	assert(msg);
+	assert(dict);
+	assert(data || data_len == 0);
+	assert(select || num_select == 0);
+
+	return message_scan(msg, dict, data, data_len, fnc1, false, select, num_select);
+
+}
+
+
+/*
+ *  Streamed validation.
+ *
+ */
+static gs1_message_err_t stream_fail(gs1_message_stream_t* const stream, const gs1_message_err_t err, const size_t pos, const size_t len)
+{
+	stream->err = err;
+	stream->err_pos = (uint16_t)pos;
+	stream->err_len = (uint16_t)len;
+	return err;
+}
+
+
+/*
+ *  The date and time fields of a component whose first linter checks a date
+ *  or time of fixed length, one character for each character of the
+ *  component, so that an illegal month, day, hour, minute or second can be
+ *  reported on the digit at which it becomes certain rather than once the
+ *  component is complete.
+ *
+ */
+static const struct {
+	gs1_linter_t linter;
+	const char *fields;
+} stream_datetimes[] = {
+	{ gs1_lint_yymmdd,	"YYMMDD" },
+	{ gs1_lint_yymmd0,	"YYMMDD" },
+	{ gs1_lint_yyyymmdd,	"YYYYMMDD" },
+	{ gs1_lint_yyyymmd0,	"YYYYMMDD" },
+	{ gs1_lint_hhmi,	"HHmm" },
+	{ gs1_lint_hh,		"HH" },
+	{ gs1_lint_mi,		"mm" },
+	{ gs1_lint_ss,		"ss" },
+};
+
+
+static const char* stream_fields(const gs1_dict_component_t* const comp)
+{
+
+	size_t i;
+
+	if (comp->cset != 'N' || comp->num_linters == 0 || comp->min != comp->max)
+		return NULL;
+
+	for (i = 0; i < sizeof(stream_datetimes) / sizeof(stream_datetimes[0]); i++) {
+		if (comp->linters[0] == stream_datetimes[i].linter &&
+		    strlen(stream_datetimes[i].fields) == comp->max)
+			return stream_datetimes[i].fields;
+	}
+
+	return NULL;
+
+}
+
+
+/*
+ *  Check the date or time field of the latest character of the current
+ *  component, so far as it has arrived. The digits have already been
+ *  checked, and anything that depends upon the complete field, such as the
+ *  last day of the month, is left to the linter.
+ *
+ */
+static gs1_lint_err_t stream_check_field(const gs1_message_stream_t* const stream, size_t* const start)
+{
+
+	const char* const d = stream->data;
+	const size_t i = (size_t)stream->len - 1;
+	const char f = stream->fields[i];
+	const bool first = i == 0 || stream->fields[i - 1] != f;
+	int v;
+
+	/*
+	 *  The least value that the field can yet take.
+	 *
+	 */
+	*start = first ? i : i - 1;
+	v = (d[*start] - '0') * 10 + (first ? 0 : d[i] - '0');
+
+	switch (f) {
+	case 'M':
+		if (GS1_LINTER_UNLIKELY(v > 12 || (!first && v == 0)))
+			return GS1_LINTER_ILLEGAL_MONTH;
+		break;
+	case 'D':	/* Follows the month */
+		if (GS1_LINTER_UNLIKELY(v > 31 || (v > 29 && d[*start - 2] == '0' && d[*start - 1] == '2')))
+			return GS1_LINTER_ILLEGAL_DAY;
+		break;
+	case 'H':
+		if (GS1_LINTER_UNLIKELY(v > 23))
+			return GS1_LINTER_ILLEGAL_HOUR;
+		break;
+	case 'm':
+		if (GS1_LINTER_UNLIKELY(v > 59))
+			return GS1_LINTER_ILLEGAL_MINUTE;
+		break;
+	case 's':
+		if (GS1_LINTER_UNLIKELY(v > 59))
+			return GS1_LINTER_ILLEGAL_SECOND;
+		break;
+	default:
+		break;
+	}
+
+	return GS1_LINTER_OK;
+
+}
+
+
+/*
+ *  Apply the linters of the current component, now that it is complete, and
+ *  move on to the next component.
+ *
+ */
+static gs1_message_err_t stream_end_component(gs1_message_stream_t* const stream)
+{
+
+	const gs1_dict_component_t* const comp = &stream->entry->components[stream->component];
+	const size_t len = stream->len;
+	gs1_lint_err_t ret = GS1_LINTER_OK;
+	size_t pos = 0, plen = 0;
+	unsigned int l;
+
+	/*
+	 *  The padding of CSET 64 data is only known once it is complete.
+	 *
+	 */
+	if (comp->cset == 'Z')
+		ret = gs1_lint_cset64(stream->data, len, &pos, &plen);
+
+	for (l = 0; ret == GS1_LINTER_OK && l < comp->num_linters; l++) {
+
+		/*
+		 *  The weights of the digits are ...3:1:3:1 counting back from
+		 *  the check digit, so the running sums of the digits at even and
+		 *  odd positions give the weighted sum for any length.
+		 *
+		 */
+		if (comp->linters[l] == gs1_lint_csum && comp->cset == 'N') {
+			const unsigned int odd = (unsigned int)(len & 1);
+			if (GS1_LINTER_UNLIKELY((3U * stream->sum[odd] + stream->sum[odd ^ 1]) % 10 != 0)) {
+				ret = GS1_LINTER_INCORRECT_CHECK_DIGIT;
+				pos = len - 1;
+				plen = 1;
+			}
+			continue;
+		}
+
+		ret = comp->linters[l](stream->data, len, &pos, &plen);
+
+	}
+
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK)) {
+		stream->lint_err = ret;
+		return stream_fail(stream, GS1_MESSAGE_LINT_FAILED, stream->component_pos + pos, plen);
+	}
+
+	stream->component++;
+	stream->len = 0;
+	stream->pads = 0;
+	stream->sum[0] = stream->sum[1] = 0;
+
+	return GS1_MESSAGE_OK;
+
+}
+
+
+static void stream_end_ai(gs1_message_stream_t* const stream)
+{
+	stream->num_ais++;
+	stream->entry = NULL;
+	stream->ai_len = 0;
+}
+
+
+/*
+ *  The value of the current AI has been ended at the given position by FNC1
+ *  or the end of the data.
+ *
+ */
+static gs1_message_err_t stream_end_value(gs1_message_stream_t* const stream, const size_t end)
+{
+
+	const gs1_dict_entry_t* const e = stream->entry;
+	const gs1_dict_component_t *comp;
+
+	if (GS1_LINTER_UNLIKELY(e->flags & GS1_DICT_FLAG_NO_FNC1))
+		return stream_fail(stream, GS1_MESSAGE_TRUNCATED_VALUE, stream->value_pos, end - stream->value_pos);
+
+	/*
+	 *  Complete the current component, after which any remaining component
+	 *  that is not optional is missing.
+	 *
+	 */
+	while (stream->component < e->num_components) {
+
+		comp = &e->components[stream->component];
+
+		if (stream->len == 0 && comp->optional)
+			break;
+
+		if (GS1_LINTER_UNLIKELY(stream->len < comp->min))
+			return stream_fail(stream, GS1_MESSAGE_INVALID_COMPONENT_LENGTH, stream->len ? stream->component_pos : end, stream->len);
+
+		if (stream_end_component(stream) != GS1_MESSAGE_OK)
+			return stream->err;
+
+	}
+
+	stream_end_ai(stream);
+
+	return GS1_MESSAGE_OK;
+
+}
+
+
+/**
+ * Begin the validation of an element string that is to be provided one
+ * character at a time with gs1_message_stream_feed().
+ *
+ * @param [out] stream The state to initialise. Must not be `NULL`.
+ * @param [in] dict The Syntax Dictionary, e.g. from gs1_dict_enter(). Must not
+ *                  be `NULL`. It must remain available until the validation
+ *                  is finished.
+ * @param [in] fnc1 The character representing FNC1, e.g. `'\x1D'` (GS). A
+ *                  leading FNC1 is ignored.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_message_stream_init(gs1_message_stream_t* const stream, const gs1_dict_t* const dict, const char fnc1)
+{
+
+	assert(stream);
+	assert(dict);
+
+	stream->dict = dict;
+	stream->fnc1 = fnc1;
+	stream->err = GS1_MESSAGE_OK;
+	stream->lint_err = GS1_LINTER_OK;
+	stream->err_pos = 0;
+	stream->err_len = 0;
+	stream->pos = 0;
+	stream->num_ais = 0;
+	stream->entry = NULL;
+	stream->ai_len = 0;
+	stream->skip_fnc1 = false;
+	stream->fields = NULL;
+
+}
+
+
+/**
+ * Validate the next character of an element string.
+ *
+ * The rules are those of gs1_message_scan(). Each character is checked
+ * against the character set of its component on arrival, as is the month,
+ * day, hour, minute or second to which it belongs in a component of fixed
+ * length whose first linter checks a date or time, e.g. a month beginning
+ * "2" fails on the "2". The linters of a component are applied when it is
+ * complete, which for a component of fixed length is on its final
+ * character, and take time proportional to its length. A check digit is
+ * verified from running sums of the digits rather than by a further pass
+ * over the component.
+ *
+ * An error is reported by the character at which it becomes certain, so
+ * where an element string has more than one error the one reported may be
+ * earlier than that reported by gs1_message_scan(), e.g. an invalid
+ * character rather than the invalid CSET 64 padding that follows it, or
+ * rather than the truncation of the value.
+ *
+ * Once an error has been reported, further characters are ignored and the
+ * same error is returned.
+ *
+ * @param [in,out] stream The state. Must not be `NULL`.
+ * @param [in] c The next character.
+ *
+ * @return #GS1_MESSAGE_OK if no error is yet certain, otherwise the reason
+ *         that the element string is not valid, which is also held in
+ *         `stream->err`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_stream_feed(gs1_message_stream_t* const stream, const char c)
+{
+
+	const gs1_dict_entry_t *e;
+	const gs1_dict_component_t *comp;
+	const uint16_t pos = stream->pos;
+	gs1_lint_err_t ret;
+	size_t start;
+
+	assert(stream);
+
+	if (GS1_LINTER_UNLIKELY(stream->err != GS1_MESSAGE_OK))
+		return stream->err;
+
+	if (GS1_LINTER_UNLIKELY(pos == UINT16_MAX))
+		return stream_fail(stream, GS1_MESSAGE_TOO_LONG, 0, 0);
+
+	stream->pos++;
+
+	/*
+	 *  Identify the AI.
+	 *
+	 */
+	if (!stream->entry) {
+
+		if (c == stream->fnc1 && stream->ai_len == 0 && (pos == 0 || stream->skip_fnc1)) {
+			stream->skip_fnc1 = false;
+			return GS1_MESSAGE_OK;
+		}
+		stream->skip_fnc1 = false;
+
+		if (GS1_LINTER_UNLIKELY(c == stream->fnc1))
+			return stream_fail(stream, GS1_MESSAGE_UNKNOWN_AI, pos - stream->ai_len, stream->ai_len + 1U);
+
+		stream->ai[stream->ai_len++] = c;
+		if (stream->ai_len < 2)
+			return GS1_MESSAGE_OK;
+
+		e = gs1_dict_lookup(stream->dict, stream->ai, stream->ai_len);
+		if (!e) {
+			if (GS1_LINTER_UNLIKELY(stream->ai_len == sizeof(stream->ai)))
+				return stream_fail(stream, GS1_MESSAGE_UNKNOWN_AI, pos + 1U - sizeof(stream->ai), sizeof(stream->ai));
+			return GS1_MESSAGE_OK;
+		}
+
+		stream->entry = e;
+		stream->value_pos = (uint16_t)(pos + 1);
+		stream->component = 0;
+		stream->len = 0;
+		stream->pads = 0;
+		stream->sum[0] = stream->sum[1] = 0;
+
+		return GS1_MESSAGE_OK;
+
+	}
+
+	e = stream->entry;
+
+	if (c == stream->fnc1 && !(e->flags & GS1_DICT_FLAG_NO_FNC1))
+		return stream_end_value(stream, pos);
+
+	if (GS1_LINTER_UNLIKELY(stream->component == e->num_components))
+		return stream_fail(stream, GS1_MESSAGE_INVALID_COMPONENT_LENGTH, pos, 1);
+
+	comp = &e->components[stream->component];
+
+	if (stream->len == 0) {
+		stream->component_pos = pos;
+		stream->fields = stream_fields(comp);
+	}
+
+	/*
+	 *  An "=" in CSET 64 data may be padding, which is only known once the
+	 *  component is complete, unless another character follows it.
+	 *
+	 */
+	if (comp->cset == 'Z' && c == '=')
+		stream->pads++;
+	else {
+		if (GS1_LINTER_UNLIKELY(stream->pads != 0)) {
+			stream->lint_err = GS1_LINTER_INVALID_CSET64_CHARACTER;
+			return stream_fail(stream, GS1_MESSAGE_LINT_FAILED, pos - stream->pads, 1);
+		}
+		ret = message_cset_linter(comp->cset)(&c, 1, NULL, NULL);
+		if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK)) {
+			stream->lint_err = ret;
+			return stream_fail(stream, GS1_MESSAGE_LINT_FAILED, pos, 1);
+		}
+	}
+
+	if (comp->cset == 'N')
+		stream->sum[stream->len & 1] = (uint16_t)(stream->sum[stream->len & 1] + (c - '0'));
+	stream->data[stream->len++] = c;
+
+	if (stream->fields) {
+		ret = stream_check_field(stream, &start);
+		if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK)) {
+			stream->lint_err = ret;
+			return stream_fail(stream, GS1_MESSAGE_LINT_FAILED, stream->component_pos + start, stream->len - start);
+		}
+	}
+
+	if (stream->len == comp->max) {
+		if (stream_end_component(stream) != GS1_MESSAGE_OK)
+			return stream->err;
+		if (stream->component == e->num_components && (e->flags & GS1_DICT_FLAG_NO_FNC1)) {
+			stream_end_ai(stream);
+			stream->skip_fnc1 = true;
+		}
+	}
+
+	return GS1_MESSAGE_OK;
+
+}
+
+
+/**
+ * Complete the validation of an element string that has been provided one
+ * character at a time.
+ *
+ * Only the remaining checks of the final component are performed. If it
+ * has variable length then its linters, and for CSET 64 data the check of
+ * its padding, are applied now that its end is known, so this takes time
+ * proportional to the length of that component, which is at most
+ * #GS1_DICT_MAX_COMPONENT_LEN characters.
+ *
+ * @param [in,out] stream The state. Must not be `NULL`.
+ *
+ * @return #GS1_MESSAGE_OK if the element string is valid, otherwise the
+ *         reason that it is not, which is also held in `stream->err`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_stream_finish(gs1_message_stream_t* const stream)
+{
+
+	assert(stream);
+
+	if (stream->err != GS1_MESSAGE_OK)
+		return stream->err;
+
+	if (!stream->entry) {
+		if (GS1_LINTER_UNLIKELY(stream->ai_len != 0))
+			return stream_fail(stream, GS1_MESSAGE_UNKNOWN_AI, stream->pos - stream->ai_len, stream->ai_len);
+		return GS1_MESSAGE_OK;
+	}
+
+	return stream_end_value(stream, stream->pos);
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+static const char test_message_dict[] =
+	"# Release: 2026-01-27\n"
+	"01        *?  N14,csum\n"
+	"10         ?  X..20\n"
+	"3103      *?  N6\n"
+	"7011       ?  N6,yymmd0 [N4],hhmi\n"
+	"7250       ?  N8,yyyymmdd\n"
+	"8008       ?  N6,yymmdd N2,hh [N2],mi [N2],ss\n"
+	"8010       ?  Y..30\n"
+	"8030       ?  Z..90\n"
+	"91         ?  X..90\n";
+
+static gs1_message_err_t test_scan(gs1_message_t* const msg, const gs1_dict_t* const dict, const char* const data)
+{
+	return gs1_message_scan(msg, dict, data, strlen(data), '^');
+}
+
+void test_gs1_message_scan(void)
+{
+
+	gs1_dict_t *dict;
+	gs1_message_t msg;
+	size_t err_line;
+	char many[4 * (GS1_MESSAGE_MAX_AIS + 1) + 1];
+	static char too_long[UINT16_MAX + 1];
+	unsigned int i;
+
+	dict = gs1_dict_load(test_message_dict, strlen(test_message_dict), &err_line);
+	TEST_ASSERT(dict != NULL);
+
+	/*
+	 *  "^" "01" "00614141999996" "10" "ABC123" "^" "3103" "000189"
+	 *  "8008" "20010112" "^" "91" "XYZ"
+	 *
+	 */
+	TEST_CHECK(test_scan(&msg, dict, "^010061414199999610ABC123^31030001898008200101" "12^91XYZ") == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.err == GS1_MESSAGE_OK);
+	TEST_ASSERT(msg.num_ais == 5);
+	TEST_CHECK(msg.num_components == 6);
+	TEST_CHECK(strcmp(msg.ai[0]->ai, "01") == 0);
+	TEST_CHECK(msg.value_pos[0] == 3 && msg.value_len[0] == 14);
+	TEST_CHECK(strcmp(msg.ai[1]->ai, "10") == 0);
+	TEST_CHECK(msg.value_pos[1] == 19 && msg.value_len[1] == 6);
+	TEST_CHECK(strcmp(msg.ai[2]->ai, "3103") == 0);
+	TEST_CHECK(msg.value_pos[2] == 30 && msg.value_len[2] == 6);
+	TEST_CHECK(strcmp(msg.ai[3]->ai, "8008") == 0);
+	TEST_CHECK(msg.value_pos[3] == 40 && msg.value_len[3] == 8);
+	TEST_CHECK(msg.component_first[3] == 3 && msg.component_first[4] == 5);
+	TEST_CHECK(msg.component_pos[3] == 40 && msg.component_len[3] == 6);
+	TEST_CHECK(msg.component_pos[4] == 46 && msg.component_len[4] == 2);
+	TEST_CHECK(strcmp(msg.ai[4]->ai, "91") == 0);
+	TEST_CHECK(msg.value_pos[4] == 51 && msg.value_len[4] == 3);
+	TEST_CHECK(msg.component_first[5] == 6);
+
+	/*
+	 *  Reuse, without the leading FNC1 and with all optional components.
+	 *
+	 */
+	TEST_CHECK(test_scan(&msg, dict, "8008200101123456") == GS1_MESSAGE_OK);
+	TEST_ASSERT(msg.num_ais == 1);
+	TEST_CHECK(msg.num_components == 4);
+	TEST_CHECK(msg.component_pos[3] == 14 && msg.component_len[3] == 2);
+
+	TEST_CHECK(test_scan(&msg, dict, "8010#-/0A^8030AZaz-_") == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.num_ais == 2);
+
+	TEST_CHECK(test_scan(&msg, dict, "8010a") == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INVALID_CSET39_CHARACTER);
+
+	TEST_CHECK(test_scan(&msg, dict, "8030+") == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INVALID_CSET64_CHARACTER);
+
+	TEST_CHECK(test_scan(&msg, dict, "") == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.num_ais == 0 && msg.num_components == 0);
+
+	TEST_CHECK(test_scan(&msg, dict, "^010061414199999689") == GS1_MESSAGE_UNKNOWN_AI);
+	TEST_CHECK(msg.num_ais == 1);
+	TEST_CHECK(msg.err_pos == 17 && msg.err_len == 2);
+
+	TEST_CHECK(test_scan(&msg, dict, "^01006141419999") == GS1_MESSAGE_TRUNCATED_VALUE);
+	TEST_CHECK(msg.num_ais == 0);
+	TEST_CHECK(msg.err_pos == 3 && msg.err_len == 12);
+
+	TEST_CHECK(test_scan(&msg, dict, "^0100614141999997") == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INCORRECT_CHECK_DIGIT);
+	TEST_CHECK(msg.err_pos == 16 && msg.err_len == 1);
+
+	TEST_CHECK(test_scan(&msg, dict, "^10AB C") == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INVALID_CSET82_CHARACTER);
+	TEST_CHECK(msg.err_pos == 5 && msg.err_len == 1);
+
+	TEST_CHECK(test_scan(&msg, dict, "^8008201301") == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_ILLEGAL_MONTH);
+	TEST_CHECK(msg.err_pos == 7 && msg.err_len == 2);
+
+	TEST_CHECK(test_scan(&msg, dict, "^8008200101") == GS1_MESSAGE_INVALID_COMPONENT_LENGTH);
+	TEST_CHECK(msg.err_pos == 11 && msg.err_len == 0);
+
+	TEST_CHECK(test_scan(&msg, dict, "^8008200101121") == GS1_MESSAGE_INVALID_COMPONENT_LENGTH);
+	TEST_CHECK(msg.err_pos == 13 && msg.err_len == 1);
+
+	TEST_CHECK(test_scan(&msg, dict, "^10ABCDEFGHIJKLMNOPQRSTU") == GS1_MESSAGE_INVALID_COMPONENT_LENGTH);
+	TEST_CHECK(msg.err_pos == 23 && msg.err_len == 1);
+
+	TEST_CHECK(test_scan(&msg, dict, "^10^91X") == GS1_MESSAGE_INVALID_COMPONENT_LENGTH);
+	TEST_CHECK(msg.err_pos == 3 && msg.err_len == 0);
+
+	for (i = 0; i < GS1_MESSAGE_MAX_AIS + 1; i++)
+		memcpy(&many[4 * i], "91X^", 4);
+	many[sizeof(many) - 1] = '\0';
+	TEST_CHECK(test_scan(&msg, dict, many) == GS1_MESSAGE_TOO_MANY_AIS);
+	TEST_CHECK(msg.num_ais == GS1_MESSAGE_MAX_AIS);
+	TEST_CHECK(msg.err_pos == 4 * GS1_MESSAGE_MAX_AIS);
+
+	memset(too_long, '9', sizeof(too_long));
+	TEST_CHECK(gs1_message_scan(&msg, dict, too_long, sizeof(too_long), '^') == GS1_MESSAGE_TOO_LONG);
+	TEST_CHECK(msg.num_ais == 0);
+
+	gs1_message_reset(&msg);
+	TEST_CHECK(msg.err == GS1_MESSAGE_OK && msg.num_ais == 0);
+
+	gs1_dict_free(dict);
+
+}
+
+void test_gs1_message_scan_select(void)
+{
+
+	gs1_dict_t *dict;
+	gs1_message_t msg;
+	size_t err_line;
+	const gs1_dict_entry_t *select[2];
+	static const char data[] = "^010061414199999610ABC 23^31030001898008201301" "12^91XYZ";
+
+	dict = gs1_dict_load(test_message_dict, strlen(test_message_dict), &err_line);
+	TEST_ASSERT(dict != NULL);
+
+	TEST_ASSERT((select[0] = gs1_dict_lookup(dict, "91", 2)) != NULL);
+	TEST_ASSERT((select[1] = gs1_dict_lookup(dict, "01", 2)) != NULL);
+
+	/*
+	 *  The invalid values of AIs (10) and (8008) are not checked.
+	 *
+	 */
+	TEST_CHECK(test_scan(&msg, dict, data) == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, data, strlen(data), '^', select, 2) == GS1_MESSAGE_OK);
+	TEST_ASSERT(msg.num_ais == 2);
+	TEST_CHECK(msg.num_components == 2);
+	TEST_CHECK(msg.ai[0] == select[1]);
+	TEST_CHECK(msg.value_pos[0] == 3 && msg.value_len[0] == 14);
+	TEST_CHECK(msg.ai[1] == select[0]);
+	TEST_CHECK(msg.value_pos[1] == 51 && msg.value_len[1] == 3);
+	TEST_CHECK(msg.component_first[1] == 1 && msg.component_first[2] == 2);
+	TEST_CHECK(msg.component_pos[1] == 51 && msg.component_len[1] == 3);
+
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, data, strlen(data), '^', select, 1) == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.num_ais == 1 && msg.ai[0] == select[0]);
+
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, data, strlen(data), '^', NULL, 0) == GS1_MESSAGE_OK);
+	TEST_CHECK(msg.num_ais == 0);
+
+	/*
+	 *  Selected AIs are checked, and unselected AIs must still be
+	 *  delimited.
+	 *
+	 */
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, "^0100614141999997", 17, '^', select, 2) == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(msg.lint_err == GS1_LINTER_INCORRECT_CHECK_DIGIT);
+
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, "^3103000189", 11, '^', select, 2) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, "^310300018", 10, '^', select, 2) == GS1_MESSAGE_TRUNCATED_VALUE);
+	TEST_CHECK(gs1_message_scan_select(&msg, dict, "^3103000189^89", 14, '^', select, 2) == GS1_MESSAGE_UNKNOWN_AI);
+	TEST_CHECK(msg.err_pos == 12);
+
+	gs1_dict_free(dict);
+
+}
+
+
+static gs1_message_err_t test_stream(gs1_message_stream_t* const stream, const gs1_dict_t* const dict, const char* data)
+{
+	gs1_message_stream_init(stream, dict, '^');
+	for (; *data; data++)
+		gs1_message_stream_feed(stream, *data);
+	return gs1_message_stream_finish(stream);
+}
+
+void test_gs1_message_stream(void)
+{
+
+	static const char* const cases[] = {
+		"^010061414199999610ABC123^31030001898008200101" "12^91XYZ",
+		"8008200101123456",
+		"8010#-/0A^8030AZaz-_",
+		"8030AB=",
+		"8030A=B",
+		"8030A==B",
+		"^8030=-",
+		"8030AB===",
+		"8030A==",
+		"8010a",
+		"8030+",
+		"",
+		"^",
+		"^010061414199999689",
+		"^0100614141999996^10X",
+		"^01006141419999",
+		"^0100614141999997",
+		"^10AB C",
+		"^8008201301",
+		"^8008200001",
+		"^8008202001",
+		"^8008200140",
+		"^8008200230",
+		"^8008200229",
+		"^800820010130",
+		"^800820010124",
+		"^80082001011260",
+		"^8008200101125960",
+		"^70112001003000",
+		"^70112001002400",
+		"^70112001002360",
+		"^725020201301",
+		"^725020010230",
+		"^725020010431",
+		"^8008200101",
+		"^8008200101121",
+		"^10ABCDEFGHIJKLMNOPQRSTU",
+		"^10^91X",
+		"^10X^^91X",
+		"^1",
+		"^9999",
+		"^0",
+	};
+
+	gs1_dict_t *dict;
+	gs1_message_t msg;
+	gs1_message_stream_t stream;
+	size_t err_line;
+	unsigned int i;
+
+	dict = gs1_dict_load(test_message_dict, strlen(test_message_dict), &err_line);
+	TEST_ASSERT(dict != NULL);
+
+	/*
+	 *  The outcome is that of scanning the whole element string.
+	 *
+	 */
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		TEST_CASE(cases[i]);
+		TEST_CHECK(test_stream(&stream, dict, cases[i]) == test_scan(&msg, dict, cases[i]));
+		TEST_CHECK(stream.lint_err == msg.lint_err);
+		TEST_CHECK(stream.err_pos == msg.err_pos);
+		TEST_MSG("Got: %d; Expected: %d", stream.err_pos, msg.err_pos);
+		if (msg.err == GS1_MESSAGE_OK)
+			TEST_CHECK(stream.num_ais == msg.num_ais);
+	}
+	TEST_CASE(NULL);
+
+	/*
+	 *  Errors are reported by the character at which they become certain,
+	 *  and persist.
+	 *
+	 */
+	gs1_message_stream_init(&stream, dict, '^');
+	TEST_CHECK(gs1_message_stream_feed(&stream, '1') == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '0') == GS1_MESSAGE_OK);
+	TEST_CHECK(stream.entry != NULL && strcmp(stream.entry->ai, "10") == 0);
+	TEST_CHECK(gs1_message_stream_feed(&stream, 'A') == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, ' ') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.err_pos == 3 && stream.err_len == 1);
+	TEST_CHECK(gs1_message_stream_feed(&stream, 'B') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(gs1_message_stream_finish(&stream) == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.pos == 4);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 15; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "010061414199999"[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '7') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_INCORRECT_CHECK_DIGIT);
+	TEST_CHECK(stream.err_pos == 15);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 7; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "8030A=="[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, 'B') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_INVALID_CSET64_CHARACTER);
+	TEST_CHECK(stream.err_pos == 5 && stream.err_len == 1);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 7; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "8008201"[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '3') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_ILLEGAL_MONTH);
+	TEST_CHECK(stream.err_pos == 6 && stream.err_len == 2);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 6; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "800820"[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '2') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_ILLEGAL_MONTH);
+	TEST_CHECK(stream.err_pos == 6 && stream.err_len == 1);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 8; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "80082002"[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '3') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_ILLEGAL_DAY);
+	TEST_CHECK(stream.err_pos == 8 && stream.err_len == 1);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < 11; i++)
+		TEST_CHECK(gs1_message_stream_feed(&stream, "70112001002"[i]) == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '4') == GS1_MESSAGE_LINT_FAILED);
+	TEST_CHECK(stream.lint_err == GS1_LINTER_ILLEGAL_HOUR);
+	TEST_CHECK(stream.err_pos == 10 && stream.err_len == 2);
+
+	gs1_message_stream_init(&stream, dict, '^');
+	for (i = 0; i < UINT16_MAX; i++)
+		gs1_message_stream_feed(&stream, "91X^"[i % 4]);
+	TEST_CHECK(stream.err == GS1_MESSAGE_OK);
+	TEST_CHECK(gs1_message_stream_feed(&stream, '^') == GS1_MESSAGE_TOO_LONG);
+
+	gs1_dict_free(dict);
+
+}
+
+#endif  /* UNIT_TESTS */
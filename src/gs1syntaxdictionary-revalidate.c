@@ -0,0 +1,281 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-revalidate.c
+ *
+ * @brief Deferred revalidation of components whose linting could not be
+ * completed because the GCP data source was offline.
+ *
+ * A scanning application that receives #GS1_LINTER_GCP_DATASOURCE_OFFLINE
+ * from a linter may record the component in a bounded queue and carry on
+ * processing. Once the GCP data source is available again the queued
+ * components are revalidated in bulk and the final outcome for each is
+ * reported through a callback.
+ *
+ * The queue storage is provided by the caller and no memory is allocated. A
+ * queue is not thread safe; each scanning thread should own its own queue.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/**
+ * Initialise a deferred revalidation queue over caller-provided storage.
+ *
+ * @param [out] queue The queue to initialise. Must not be `NULL`.
+ * @param [in] items Array of at least `capacity` entries that will hold the
+ *                   pending items. Must remain valid for the lifetime of the
+ *                   queue.
+ * @param [in] capacity Maximum number of pending items.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_lint_revalidate_init(gs1_lint_revalidate_queue_t* const queue, gs1_lint_revalidate_item_t* const items, size_t capacity)
+{
+
+	assert(queue);
+	assert(items || capacity == 0);
+
+	queue->items = items;
+	queue->capacity = capacity;
+	queue->head = 0;
+	queue->count = 0;
+
+}
+
+
+/**
+ * Record a component for later revalidation.
+ *
+ * The component data is copied into the queue so the caller's buffer may be
+ * reused as soon as this function returns.
+ *
+ * @param [in,out] queue The queue in which to record the item.
+ * @param [in] linter The linter that reported
+ *                    #GS1_LINTER_GCP_DATASOURCE_OFFLINE for the component.
+ * @param [in] data Pointer to the component data. Must not be `NULL`.
+ * @param [in] data_len Length of the component data.
+ * @param [in] offset Position of the component within the caller's message,
+ *                    returned unaltered to the callback.
+ * @param [in] user Opaque caller value identifying the message, returned
+ *                  unaltered to the callback.
+ *
+ * @return `true` if the item was queued.
+ * @return `false` if the queue is full or the component exceeds
+ *         #GS1_LINTER_REVALIDATE_MAX_DATA_LEN, in which case the caller must
+ *         decide whether to fail the component immediately.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_revalidate_push(gs1_lint_revalidate_queue_t* const queue, gs1_linter_t linter, const char* const data, size_t data_len, size_t offset, void* const user)
+{
+
+	gs1_lint_revalidate_item_t *item;
+
+	assert(queue);
+	assert(linter);
+	assert(data);
+
+	if (GS1_LINTER_UNLIKELY(queue->count == queue->capacity ||
+				data_len > GS1_LINTER_REVALIDATE_MAX_DATA_LEN))
+		return false;
+
+	item = &queue->items[(queue->head + queue->count) % queue->capacity];
+	item->linter = linter;
+	item->user = user;
+	item->offset = offset;
+	item->data_len = data_len;
+	memcpy(item->data, data, data_len);
+
+	queue->count++;
+
+	return true;
+
+}
+
+
+/**
+ * Revalidate the pending items in the order that they were queued.
+ *
+ * Each item is passed to its linter again. If the linter still reports
+ * #GS1_LINTER_GCP_DATASOURCE_OFFLINE then processing stops and that item,
+ * together with all items after it, remain queued for a later attempt.
+ * Otherwise the final outcome is reported through the callback and the item
+ * is removed from the queue.
+ *
+ * @param [in,out] queue The queue to process.
+ * @param [in] callback Function receiving the final outcome of each item.
+ * @param [in] ctx Opaque caller value passed to each callback invocation.
+ *
+ * @return The number of items that remain pending.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_revalidate_run(gs1_lint_revalidate_queue_t* const queue, gs1_lint_revalidate_cb_t callback, void* const ctx)
+{
+
+	assert(queue);
+	assert(callback);
+
+	while (queue->count > 0) {
+
+		const gs1_lint_revalidate_item_t *item = &queue->items[queue->head];
+		size_t err_pos = 0, err_len = 0;
+		gs1_lint_err_t err;
+
+		err = item->linter(item->data, item->data_len, &err_pos, &err_len);
+		if (GS1_LINTER_UNLIKELY(err == GS1_LINTER_GCP_DATASOURCE_OFFLINE))
+			break;
+
+		callback(ctx, item->user, item->offset, item->data, item->data_len, err, err_pos, err_len);
+
+		queue->head = (queue->head + 1) % queue->capacity;
+		queue->count--;
+
+	}
+
+	return queue->count;
+
+}
+
+
+/**
+ * Return the number of items awaiting revalidation.
+ *
+ * @param [in] queue The queue to inspect.
+ *
+ * @return The number of pending items.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_revalidate_pending(const gs1_lint_revalidate_queue_t* const queue)
+{
+	assert(queue);
+	return queue->count;
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+extern int test_gcp_lookup_result;
+
+struct revalidate_result_s {
+	size_t calls;
+	void *user;
+	size_t offset;
+	char data[GS1_LINTER_REVALIDATE_MAX_DATA_LEN + 1];
+	gs1_lint_err_t err;
+	size_t err_pos;
+	size_t err_len;
+};
+
+static void revalidate_cb(void *ctx, void *user, size_t offset, const char *data, size_t data_len, gs1_lint_err_t err, size_t err_pos, size_t err_len)
+{
+	struct revalidate_result_s *r = (struct revalidate_result_s *)ctx;
+
+	r->calls++;
+	r->user = user;
+	r->offset = offset;
+	memcpy(r->data, data, data_len);
+	r->data[data_len] = '\0';
+	r->err = err;
+	r->err_pos = err_pos;
+	r->err_len = err_len;
+}
+
+void test_gs1_lint_revalidate(void)
+{
+
+	gs1_lint_revalidate_item_t items[2];
+	gs1_lint_revalidate_queue_t queue;
+	struct revalidate_result_s r;
+	char buf[16], big[GS1_LINTER_REVALIDATE_MAX_DATA_LEN + 1];
+	int msg1, msg2, msg3;
+
+	memset(&r, 0, sizeof(r));
+	memset(big, '1', sizeof(big));
+
+	gs1_lint_revalidate_init(&queue, items, 2);
+	TEST_CHECK(gs1_lint_revalidate_pending(&queue) == 0);
+	TEST_CHECK(gs1_lint_revalidate_run(&queue, revalidate_cb, &r) == 0);
+	TEST_CHECK(r.calls == 0);
+
+	/*
+	 * Data is copied so the caller's buffer may be reused.
+	 *
+	 */
+	strcpy(buf, "95012345");
+	TEST_CHECK(gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, buf, strlen(buf), 2, &msg1));
+	strcpy(buf, "0614141");
+	TEST_CHECK(gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, buf, strlen(buf), 20, &msg2));
+	TEST_CHECK(!gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, buf, strlen(buf), 0, &msg3));	// Full
+	TEST_CHECK(gs1_lint_revalidate_pending(&queue) == 2);
+
+	/*
+	 * Still offline: nothing is reported and everything remains queued.
+	 *
+	 */
+	test_gcp_lookup_result = 2;
+	TEST_CHECK(gs1_lint_revalidate_run(&queue, revalidate_cb, &r) == 2);
+	TEST_CHECK(r.calls == 0);
+
+	/*
+	 * Source is back online and reports a bad prefix for each item. The
+	 * last report received is for the second item.
+	 *
+	 */
+	test_gcp_lookup_result = 1;
+	TEST_CHECK(gs1_lint_revalidate_run(&queue, revalidate_cb, &r) == 0);
+	TEST_CHECK(r.calls == 2);
+	TEST_CHECK(r.user == &msg2);
+	TEST_CHECK(r.offset == 20);
+	TEST_CHECK(strcmp(r.data, "0614141") == 0);
+	TEST_CHECK(r.err == GS1_LINTER_INVALID_GCP_PREFIX);
+	TEST_CHECK(r.err_pos == 0);
+	TEST_CHECK(r.err_len == 7);
+
+	/*
+	 * Ring wraps around; reports are delivered in queued order.
+	 *
+	 */
+	test_gcp_lookup_result = 0;
+	TEST_CHECK(gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, "12345", 5, 0, &msg3));
+	TEST_CHECK(gs1_lint_revalidate_pending(&queue) == 1);
+	r.calls = 0;
+	TEST_CHECK(gs1_lint_revalidate_run(&queue, revalidate_cb, &r) == 0);
+	TEST_CHECK(r.calls == 1);
+	TEST_CHECK(r.user == &msg3);
+	TEST_CHECK(r.err == GS1_LINTER_OK);
+
+	/*
+	 * Oversized components are rejected.
+	 *
+	 */
+	TEST_CHECK(!gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, big, sizeof(big), 0, NULL));
+	TEST_CHECK(gs1_lint_revalidate_push(&queue, gs1_lint_gcppos1, big, sizeof(big) - 1, 0, NULL));
+
+}
+
+#endif  /* UNIT_TESTS */
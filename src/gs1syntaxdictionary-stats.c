@@ -0,0 +1,381 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-stats.c
+ *
+ * @brief Optional counters of the calls to each linter, the bytes processed
+ * and the number of times each ::gs1_lint_err_t was returned.
+ *
+ * The counters are only maintained when the library is built with
+ * `GS1_LINTER_STATS` defined, in which case every return from a reference
+ * linter is recorded by the GS1_LINTER_RETURN_OK and GS1_LINTER_RETURN_ERROR
+ * macros. Otherwise the linters are unchanged and gs1_linter_stats_snapshot()
+ * reports that no statistics are available.
+ *
+ * Counters are held in shards. Each thread is assigned a shard on its first
+ * linter call, in turn, so that threads update separate cache lines and the
+ * increments are uncontended until there are more threads than shards. The
+ * shards are summed when a snapshot is taken.
+ *
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+#ifdef GS1_LINTER_STATS
+
+#ifndef GS1_LINTER_STATS_SHARDS
+#define GS1_LINTER_STATS_SHARDS 8
+#endif
+
+/*
+ * Counters are kept for at most this many linters, the first in name order.
+ * A build that provides a longer list through GS1_LINTER_CUSTOM_LINTERS_H
+ * should raise it.
+ *
+ */
+#ifndef GS1_LINTER_STATS_MAX_LINTERS
+#define GS1_LINTER_STATS_MAX_LINTERS 64
+#endif
+
+#define GS1_LINTER_STATS_PREFIX "gs1_lint_"
+
+
+static struct {
+	volatile uint64_t bytes[GS1_LINTER_STATS_MAX_LINTERS];
+	volatile uint64_t returns[GS1_LINTER_STATS_MAX_LINTERS][__GS1_LINTER_NUM_ERRS];
+} shards[GS1_LINTER_STATS_SHARDS];
+
+static volatile long next_shard;
+
+
+static size_t stats_num_linters(void)
+{
+	return name_function_map_len < GS1_LINTER_STATS_MAX_LINTERS ? name_function_map_len : GS1_LINTER_STATS_MAX_LINTERS;
+}
+
+
+/*
+ * Index of a linter in name_function_map, given the name of its function, or
+ * -1 if it is not a linter for which counters are kept.
+ *
+ */
+static long stats_linter_index(const char* const func)
+{
+
+	size_t s = 0, e = name_function_map_len;
+	const char *name = func;
+
+	if (strncmp(name, GS1_LINTER_STATS_PREFIX, strlen(GS1_LINTER_STATS_PREFIX)) != 0)
+		return -1;
+	name += strlen(GS1_LINTER_STATS_PREFIX);
+
+	while (s < e) {
+		const size_t m = s + (e - s) / 2;
+		const int cmp = strcmp(gs1_lint_name(m), name);
+		if (cmp == 0)
+			return m < GS1_LINTER_STATS_MAX_LINTERS ? (long)m : -1;
+		if (cmp < 0)
+			s = m + 1;
+		else
+			e = m;
+	}
+
+	return -1;
+
+}
+
+
+/*
+ * Record a return from a linter. Called by GS1_LINTER_STATS_RECORD, which
+ * supplies a cache for the linter's index at each return site so that the
+ * function name is only looked up on the first call.
+ *
+ * The cache holds zero until resolved, then the index plus one, or -1 if the
+ * function is not a linter in name_function_map.
+ *
+ */
+GS1_LINTER_INTERNAL void gs1_lint_stats_record(volatile long* const id, const char* const func, const size_t data_len, const gs1_lint_err_t err)
+{
+
+	static GS1_LINTER_THREAD_LOCAL unsigned int shard;	// One-based; zero until assigned
+	long i = GS1_LINTER_ATOMIC_LOAD(id);
+
+	assert((size_t)err < __GS1_LINTER_NUM_ERRS);
+
+	if (GS1_LINTER_UNLIKELY(i == 0)) {
+		i = stats_linter_index(func);
+		i = i >= 0 ? i + 1 : -1;
+		(void)GS1_LINTER_ATOMIC_XCHG(id, i);
+	}
+	if (GS1_LINTER_UNLIKELY(i < 0))
+		return;
+
+	if (GS1_LINTER_UNLIKELY(shard == 0))
+		shard = (unsigned int)((unsigned long)GS1_LINTER_ATOMIC_ADD(&next_shard, 1) % GS1_LINTER_STATS_SHARDS) + 1;
+
+	GS1_LINTER_ATOMIC_COUNT64(&shards[shard - 1].bytes[i - 1], data_len);
+	GS1_LINTER_ATOMIC_COUNT64(&shards[shard - 1].returns[i - 1][err], 1);
+
+}
+
+#endif  /* GS1_LINTER_STATS */
+
+
+/**
+ * Take a snapshot of the linter statistics.
+ *
+ * Statistics are only collected when the library is built with
+ * `GS1_LINTER_STATS` defined. Each call to a reference linter is counted,
+ * including calls that one linter makes to another, e.g. `hhmi` calls `hh`
+ * and `mi`.
+ *
+ * The counters for each linter are read while other threads may still be
+ * updating them, so the snapshot is not an instantaneous view across all
+ * linters, but no update is ever lost or partially read.
+ *
+ * @param [out] stats An array to receive the statistics for each linter, in
+ *                    the order of their names, or `NULL` to query the number
+ *                    of entries required.
+ * @param [in] max The number of elements in `stats`.
+ *
+ * @return The number of entries written to `stats`, or if `stats` is `NULL`
+ *         the number of linters for which statistics are available.
+ * @return 0 if the library was built without `GS1_LINTER_STATS`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API size_t gs1_linter_stats_snapshot(gs1_linter_stats_t* const stats, const size_t max)
+{
+
+#ifdef GS1_LINTER_STATS
+
+	size_t i, n;
+	unsigned int s, e;
+
+	n = stats_num_linters();
+	if (!stats)
+		return n;
+
+	if (max < n)
+		n = max;
+
+	for (i = 0; i < n; i++) {
+		memset(&stats[i], 0, sizeof(stats[i]));
+		stats[i].name = gs1_lint_name(i);
+		for (s = 0; s < GS1_LINTER_STATS_SHARDS; s++) {
+			stats[i].bytes += GS1_LINTER_ATOMIC_LOAD64(&shards[s].bytes[i]);
+			for (e = 0; e < __GS1_LINTER_NUM_ERRS; e++) {
+				const uint64_t r = GS1_LINTER_ATOMIC_LOAD64(&shards[s].returns[i][e]);
+				stats[i].returns[e] += r;
+				stats[i].calls += r;
+			}
+		}
+	}
+
+	return n;
+
+#else
+
+	(void)stats;
+	(void)max;
+
+	return 0;
+
+#endif
+
+}
+
+
+/**
+ * Reset all of the linter statistics to zero, e.g. at the start of a
+ * monitoring interval.
+ *
+ * Calls that are in progress on other threads may be counted in either the
+ * old or the new interval.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API void gs1_linter_stats_reset(void)
+{
+
+#ifdef GS1_LINTER_STATS
+
+	size_t i;
+	unsigned int s, e;
+
+	for (s = 0; s < GS1_LINTER_STATS_SHARDS; s++) {
+		for (i = 0; i < stats_num_linters(); i++) {
+			(void)GS1_LINTER_ATOMIC_XCHG64(&shards[s].bytes[i], 0);
+			for (e = 0; e < __GS1_LINTER_NUM_ERRS; e++)
+				(void)GS1_LINTER_ATOMIC_XCHG64(&shards[s].returns[i][e], 0);
+		}
+	}
+
+#endif
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#ifndef GS1_LINTER_STATS
+
+void test_gs1_linter_stats(void)
+{
+
+	gs1_linter_stats_t stats[1];
+
+	gs1_linter_stats_reset();
+	TEST_CHECK(gs1_linter_stats_snapshot(NULL, 0) == 0);
+	TEST_CHECK(gs1_linter_stats_snapshot(stats, 1) == 0);
+
+}
+
+#else
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <pthread.h>
+
+#define STATS_THREADS 12
+#define STATS_CALLS 10000
+
+static void* stats_worker(void *arg)
+{
+	int i;
+	(void)arg;
+	for (i = 0; i < STATS_CALLS; i++)
+		(void)gs1_lint_yesno(i % 2 ? "1" : "2", 1, NULL, NULL);
+	return NULL;
+}
+
+#endif
+
+static size_t stats_index(const char* const name)
+{
+	size_t i;
+	for (i = 0; strcmp(gs1_lint_name(i), name) != 0; i++)
+		;
+	return i;
+}
+
+void test_gs1_linter_stats(void)
+{
+
+	static gs1_linter_stats_t stats[GS1_LINTER_STATS_MAX_LINTERS];
+	const gs1_linter_stats_t *st;
+	volatile long id;
+	size_t n;
+
+	TEST_ASSERT(name_function_map_len <= GS1_LINTER_STATS_MAX_LINTERS);
+	TEST_CHECK(gs1_linter_stats_snapshot(NULL, 0) == name_function_map_len);
+
+	gs1_linter_stats_reset();
+
+	TEST_CHECK(gs1_lint_yesno("1", 1, NULL, NULL) == GS1_LINTER_OK);
+	TEST_CHECK(gs1_lint_yesno("2", 1, NULL, NULL) == GS1_LINTER_NOT_ZERO_OR_ONE);
+	TEST_CHECK(gs1_lint_yesno("12", 2, NULL, NULL) == GS1_LINTER_NOT_ZERO_OR_ONE);
+	TEST_CHECK(gs1_lint_hhmi("2460", 4, NULL, NULL) == GS1_LINTER_ILLEGAL_HOUR);
+
+	n = gs1_linter_stats_snapshot(stats, GS1_LINTER_STATS_MAX_LINTERS);
+	TEST_ASSERT(n == name_function_map_len);
+
+	st = &stats[stats_index("yesno")];
+	TEST_CHECK(st->calls == 3);
+	TEST_CHECK(st->bytes == 4);
+	TEST_CHECK(st->returns[GS1_LINTER_OK] == 1);
+	TEST_CHECK(st->returns[GS1_LINTER_NOT_ZERO_OR_ONE] == 2);
+
+	/*
+	 * Calls between linters are counted for both.
+	 *
+	 */
+	st = &stats[stats_index("hhmi")];
+	TEST_CHECK(st->calls == 1);
+	TEST_CHECK(st->returns[GS1_LINTER_ILLEGAL_HOUR] == 1);
+	st = &stats[stats_index("hh")];
+	TEST_CHECK(st->calls == 1);
+	TEST_CHECK(st->bytes == 2);
+	st = &stats[stats_index("mi")];
+	TEST_CHECK(st->calls == 0);
+
+	/*
+	 * Partial snapshot, in name order.
+	 *
+	 */
+	TEST_CHECK(gs1_linter_stats_snapshot(stats, 1) == 1);
+	TEST_CHECK(strcmp(stats[0].name, "couponcode") == 0);
+
+	/*
+	 * Returns from functions that are not known linters are ignored.
+	 *
+	 */
+	id = 0;
+	gs1_lint_stats_record(&id, "custom", 1, GS1_LINTER_OK);
+	TEST_CHECK(id == -1);
+	gs1_lint_stats_record(&id, "custom", 1, GS1_LINTER_OK);
+	id = 0;
+	gs1_lint_stats_record(&id, "gs1_lint_custom", 1, GS1_LINTER_OK);
+	TEST_CHECK(id == -1);
+	id = 0;
+	gs1_lint_stats_record(&id, "gs1_lint_zzz", 1, GS1_LINTER_OK);
+	TEST_CHECK(id == -1);
+
+	gs1_linter_stats_reset();
+	n = gs1_linter_stats_snapshot(stats, GS1_LINTER_STATS_MAX_LINTERS);
+	st = &stats[stats_index("yesno")];
+	TEST_CHECK(st->calls == 0);
+	TEST_CHECK(st->bytes == 0);
+
+#if defined(__unix__) || defined(__APPLE__)
+{
+	/*
+	 * Concurrent callers, more than there are shards, lose no counts.
+	 *
+	 */
+	pthread_t threads[STATS_THREADS];
+	int i;
+
+	for (i = 0; i < STATS_THREADS; i++)
+		TEST_ASSERT(pthread_create(&threads[i], NULL, stats_worker, NULL) == 0);
+	for (i = 0; i < STATS_THREADS; i++)
+		TEST_ASSERT(pthread_join(threads[i], NULL) == 0);
+
+	n = gs1_linter_stats_snapshot(stats, GS1_LINTER_STATS_MAX_LINTERS);
+	st = &stats[stats_index("yesno")];
+	TEST_CHECK(st->calls == STATS_THREADS * STATS_CALLS);
+	TEST_CHECK(st->bytes == STATS_THREADS * STATS_CALLS);
+	TEST_CHECK(st->returns[GS1_LINTER_OK] == STATS_THREADS * STATS_CALLS / 2);
+	TEST_CHECK(st->returns[GS1_LINTER_NOT_ZERO_OR_ONE] == STATS_THREADS * STATS_CALLS / 2);
+}
+#endif
+
+}
+
+#endif  /* GS1_LINTER_STATS */
+
+#endif  /* UNIT_TESTS */
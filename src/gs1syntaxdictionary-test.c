@@ -92,6 +92,26 @@ void test_lint__stubs(void);
 void test_name_function_map_is_sorted(void);
 void test_gs1_linter_from_name(void);
 void test_gs1_linter_err_str_en_size(void);
+void test_gs1_lint_err_msg(void);
+
+void test_gs1_lint_epoch(void);
+void test_gs1_lint_codelist(void);
+void test_gs1_lint_revalidate(void);
+void test_gs1_lint_bulk(void);
+void test_gs1_lint_valid(void);
+void test_gs1_lint_collect(void);
+void test_gs1_arena(void);
+void test_gs1_message_scan(void);
+void test_gs1_message_scan_select(void);
+void test_gs1_message_stream(void);
+void test_gs1_input_identify(void);
+void test_gs1_message_scan_input(void);
+void test_gs1_dict_load(void);
+void test_gs1_dict_install(void);
+void test_gs1_dict_store(void);
+void test_gs1_dict_store_arena(void);
+
+void test_gs1_linter_stats(void);
 
 
 TEST_LIST = {
@@ -142,8 +162,28 @@ TEST_LIST = {
 	{ "gs1_linter_from_name", test_gs1_linter_from_name },
 #ifdef GS1_LINTER_ERR_STR_EN
 	{ "gs1_linter_err_str_en_size", test_gs1_linter_err_str_en_size },
+	{ "gs1_lint_err_msg", test_gs1_lint_err_msg },
 #endif
 
+	{ "gs1_lint_epoch", test_gs1_lint_epoch },
+	{ "gs1_lint_codelist", test_gs1_lint_codelist },
+	{ "gs1_lint_revalidate", test_gs1_lint_revalidate },
+	{ "gs1_lint_bulk", test_gs1_lint_bulk },
+	{ "gs1_lint_valid", test_gs1_lint_valid },
+	{ "gs1_lint_collect", test_gs1_lint_collect },
+	{ "gs1_arena", test_gs1_arena },
+	{ "gs1_message_scan", test_gs1_message_scan },
+	{ "gs1_message_scan_select", test_gs1_message_scan_select },
+	{ "gs1_message_stream", test_gs1_message_stream },
+	{ "gs1_input_identify", test_gs1_input_identify },
+	{ "gs1_message_scan_input", test_gs1_message_scan_input },
+	{ "gs1_dict_load", test_gs1_dict_load },
+	{ "gs1_dict_install", test_gs1_dict_install },
+	{ "gs1_dict_store", test_gs1_dict_store },
+	{ "gs1_dict_store_arena", test_gs1_dict_store_arena },
+
+	{ "gs1_linter_stats", test_gs1_linter_stats },
+
 	{ NULL, NULL }
 
 };
@@ -36,6 +36,24 @@
 #include <string.h>
 
 
+/*
+ * Linkage of functions and variables that are shared between the library's
+ * sources but are not part of its API. In the single-file amalgamation (see
+ * "make amalgamation") these have internal linkage, so that the compiler sees
+ * every use and is free to inline or specialise them.
+ *
+ */
+/// \cond
+#ifdef GS1_LINTER_AMALGAMATION
+#  define GS1_LINTER_INTERNAL static
+#  define GS1_LINTER_INTERNAL_VAR static
+#else
+#  define GS1_LINTER_INTERNAL
+#  define GS1_LINTER_INTERNAL_VAR extern
+#endif
+/// \endcond
+
+
 #if defined(__clang__)
 #  define DIAG_PUSH _Pragma("clang diagnostic push")
 #  define DIAG_POP _Pragma("clang diagnostic pop")
@@ -77,6 +95,74 @@
 #endif
 
 
+/**
+ * @def GS1_LINTER_ALWAYS_INLINE
+ * @brief Implementation may require the compiler to inline a function, such as
+ * one shared by a linter and its gs1_parse_*() companion, so that the linter's
+ * copy is specialised for the case where no fields are recorded. Size-optimised
+ * builds leave this to the compiler.
+ *
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__OPTIMIZE_SIZE__)
+#  define GS1_LINTER_ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#  define GS1_LINTER_ALWAYS_INLINE __forceinline
+#else
+#  define GS1_LINTER_ALWAYS_INLINE inline
+#endif
+
+
+/**
+ * @def GS1_LINTER_PROBE_ENTRY
+ * @brief When built with `GS1_LINTER_USDT`, a static tracepoint at the start
+ * of a linter, with the linter function name, data and data length as
+ * arguments.
+ *
+ * @def GS1_LINTER_PROBE_RETURN
+ * @brief When built with `GS1_LINTER_USDT`, a static tracepoint at the return
+ * from a linter, with the linter function name, data length, return code and
+ * the error position and length as given to the caller (zero when not
+ * requested) as arguments.
+ *
+ * The tracepoints are defined using the `sys/sdt.h` macros provided by
+ * SystemTap, which compile to a single no-op instruction and an ELF note.
+ * They can be attached to in a running process with tools such as bpftrace,
+ * e.g. `usdt:libgs1syntaxdictionary.so:gs1syntaxdictionary:linter_return`.
+ *
+ */
+#ifdef GS1_LINTER_USDT
+#  include <sys/sdt.h>
+#  define GS1_LINTER_PROBE_ENTRY()						\
+	DTRACE_PROBE3(gs1syntaxdictionary, linter_entry, (const char *)__func__, data, data_len)
+#  define GS1_LINTER_PROBE_RETURN(error)						\
+	DTRACE_PROBE5(gs1syntaxdictionary, linter_return, (const char *)__func__, data_len, (int)(error),	\
+		      err_pos ? *err_pos : 0, err_len ? *err_len : 0)
+#else
+#  define GS1_LINTER_PROBE_ENTRY() do { } while (0)
+#  define GS1_LINTER_PROBE_RETURN(error) do { } while (0)
+#endif
+
+
+/**
+ * @def GS1_LINTER_STATS_RECORD
+ * @brief When built with `GS1_LINTER_STATS`, count a return from a linter in
+ * the statistics reported by gs1_linter_stats_snapshot().
+ *
+ * @param [in] error The ::gs1_lint_err_t being returned.
+ *
+ */
+#ifdef GS1_LINTER_STATS
+GS1_LINTER_INTERNAL void gs1_lint_stats_record(volatile long *id, const char *func, size_t data_len, gs1_lint_err_t err);
+#  define GS1_LINTER_STATS_RECORD(error)					\
+do {										\
+	static volatile long gs1_lint_stats_id;					\
+	gs1_lint_stats_record(&gs1_lint_stats_id, __func__, data_len, error);	\
+} while (0)
+#else
+#  define GS1_LINTER_STATS_RECORD(error) do { } while (0)
+#endif
+
+
 /**
  * @brief Return from a linter indicating that no problem was detected with the
  * given data.
@@ -87,6 +173,8 @@
  */
 #define GS1_LINTER_RETURN_OK 		\
 do {					\
+	GS1_LINTER_STATS_RECORD(GS1_LINTER_OK);	\
+	GS1_LINTER_PROBE_RETURN(GS1_LINTER_OK);	\
 	return GS1_LINTER_OK;		\
 } while (0)
 
@@ -101,6 +189,30 @@ do {					\
  *
  */
 #define GS1_LINTER_RETURN_ERROR(error, position, length)	\
+do {								\
+	const gs1_lint_err_t gs1_lint_ret = error;		\
+	GS1_LINTER_STATS_RECORD(gs1_lint_ret);			\
+	if (err_pos) *err_pos = position;			\
+	if (err_len) *err_len = length;				\
+	GS1_LINTER_PROBE_RETURN(gs1_lint_ret);			\
+	return gs1_lint_ret;					\
+} while (0)
+
+
+/**
+ * @brief Return an error from a worker that is shared by a linter and its
+ * gs1_parse_*() companion.
+ *
+ * Unlike GS1_LINTER_RETURN_ERROR(), the return is neither counted in the
+ * statistics nor traced, since the linter does both with the result of the
+ * worker.
+ *
+ * @param [in] error The ::gs1_lint_err_t being returned.
+ * @param [in] position The position of the error.
+ * @param [in] length The length of the error.
+ *
+ */
+#define GS1_LINTER_DECODE_ERROR(error, position, length)	\
 do {								\
 	if (err_pos) *err_pos = position;			\
 	if (err_len) *err_len = length;				\
@@ -163,4 +275,515 @@ do {									\
 	}								\
 } while (0)
 
+
+/*
+ * Sequentially consistent atomic operations on `long` and pointer values, as
+ * used by the runtime-replaceable tables, and relaxed operations on 64-bit
+ * counters, as used by the linter statistics.
+ *
+ */
+/// \cond
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  define GS1_LINTER_ATOMIC_LOAD(p)		_InterlockedCompareExchange((long volatile *)(p), 0, 0)
+#  define GS1_LINTER_ATOMIC_ADD(p, v)		_InterlockedExchangeAdd((long volatile *)(p), (v))
+#  define GS1_LINTER_ATOMIC_XCHG(p, v)		_InterlockedExchange((long volatile *)(p), (v))
+#  define GS1_LINTER_ATOMIC_LOAD_PTR(p)		_InterlockedCompareExchangePointer((void * volatile *)(p), NULL, NULL)
+#  define GS1_LINTER_ATOMIC_XCHG_PTR(p, v)	_InterlockedExchangePointer((void * volatile *)(p), (v))
+#  define GS1_LINTER_ATOMIC_COUNT64(p, v)	_InterlockedExchangeAdd64((__int64 volatile *)(p), (__int64)(v))
+#  define GS1_LINTER_ATOMIC_LOAD64(p)		(uint64_t)_InterlockedCompareExchange64((__int64 volatile *)(p), 0, 0)
+#  define GS1_LINTER_ATOMIC_XCHG64(p, v)	_InterlockedExchange64((__int64 volatile *)(p), (__int64)(v))
+#  define GS1_LINTER_THREAD_LOCAL		__declspec(thread)
+#else
+#  define GS1_LINTER_ATOMIC_LOAD(p)		__atomic_load_n((p), __ATOMIC_SEQ_CST)
+#  define GS1_LINTER_ATOMIC_ADD(p, v)		__atomic_fetch_add((p), (v), __ATOMIC_SEQ_CST)
+#  define GS1_LINTER_ATOMIC_XCHG(p, v)		__atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#  define GS1_LINTER_ATOMIC_LOAD_PTR(p)		__atomic_load_n((p), __ATOMIC_SEQ_CST)
+#  define GS1_LINTER_ATOMIC_XCHG_PTR(p, v)	__atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#  define GS1_LINTER_ATOMIC_COUNT64(p, v)	__atomic_fetch_add((p), (uint64_t)(v), __ATOMIC_RELAXED)
+#  define GS1_LINTER_ATOMIC_LOAD64(p)		__atomic_load_n((p), __ATOMIC_RELAXED)
+#  define GS1_LINTER_ATOMIC_XCHG64(p, v)	__atomic_exchange_n((p), (uint64_t)(v), __ATOMIC_RELAXED)
+#  define GS1_LINTER_THREAD_LOCAL		__thread
+#endif
+/// \endcond
+
+
+/**
+ * @brief The two-digit year of the current year, from which the century of a
+ * YYMMDD date is determined.
+ *
+ */
+#ifndef CURRENT_YEAR
+#define CURRENT_YEAR 21  ///< 20YY: For converting YY to 19YY, 20YY, 21YY, etc. for leap year validation
+#endif
+
+/*
+ *  Convert YY to a year using a horizon based on CURRENT_YEAR.
+ *
+ */
+static inline int gs1_lint_yy_to_year(const int yy)
+{
+	if (yy - CURRENT_YEAR >= 51)
+		return 1900 + yy;
+	if (yy - CURRENT_YEAR > -50)
+		return 2000 + yy;
+	return 2100 + yy;
+}
+
+
+/*
+ * Helpers for the gs1_parse_* functions, which decode the data as it is
+ * validated by a worker that is shared with the corresponding linter.
+ *
+ * Defining GS1_LINTER_NO_PARSE omits the gs1_parse_*() functions, for builds
+ * that only lint.
+ *
+ */
+
+/*
+ *  Append a digit to a value, saturating at UINT64_MAX.
+ *
+ */
+static inline uint64_t gs1_parse_digit_append(const uint64_t value, const char c)
+{
+	const uint64_t d = (uint64_t)(c - '0');
+	if (GS1_LINTER_UNLIKELY(value > (UINT64_MAX - d) / 10))
+		return UINT64_MAX;
+	return value * 10 + d;
+}
+
+/*
+ *  Value of a run of digits, saturating at UINT64_MAX.
+ *
+ */
+static inline uint64_t gs1_parse_digits(const char* const data, const size_t len)
+{
+
+	uint64_t value = 0;
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		value = gs1_parse_digit_append(value, data[i]);
+
+	return value;
+
+}
+
+/*
+ *  Days since 1970-01-01 of a date in the proleptic Gregorian calendar, where
+ *  day 0 denotes the last day of the month.
+ *
+ */
+static inline int32_t gs1_parse_epoch_day(int year, int month, const int day)
+{
+
+	int era, yoe, doy;
+
+	if (day == 0 && ++month > 12) {		/* Day before the 1st of next month */
+		month = 1;
+		year++;
+	}
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year - 399) / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + (day == 0 ? 0 : day - 1);
+
+	return (int32_t)(era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468 - (day == 0));
+
+}
+
+
+/*
+ *  Record a date that has been accepted by a date linter.
+ *
+ */
+static inline void gs1_parse_date_set(gs1_parse_date_t* const date, const int year, const int month, const int day)
+{
+	date->year = (uint16_t)year;
+	date->month = (uint8_t)month;
+	date->day = (uint8_t)day;
+	date->epoch_day = gs1_parse_epoch_day(year, month, day);
+}
+
+/*
+ *  Decode the MMDD part of a date that has been accepted by a date linter.
+ *
+ */
+static inline void gs1_parse_date_fill(gs1_parse_date_t* const date, const int year, const char* const mmdd)
+{
+	gs1_parse_date_set(date, year, (int)gs1_parse_digits(mmdd, 2), (int)gs1_parse_digits(mmdd + 2, 2));
+}
+
+
+/*
+ * Declarative description of a format made up of single digit codes,
+ * fixed-length fields, dates and fields whose length is given by a preceding
+ * variable length indicator (VLI), as used by the coupon linters.
+ *
+ * A schema is an array of steps that is run against the data by
+ * gs1_lint_vli_run(). Any data that remains once the steps have been run is
+ * reported as GS1_LINTER_COUPON_EXCESS_DATA.
+ *
+ */
+enum {
+	GS1_LINTER_VLI_DIGIT,		// A single digit that must be in `digits`
+	GS1_LINTER_VLI_FIXED,		// A field of `len` digits
+	GS1_LINTER_VLI_VAR,		// A VLI digit that must be in `digits`, then a field of VLI + `len` digits
+	GS1_LINTER_VLI_DATE,		// A six-digit date, checked by `lint`
+	GS1_LINTER_VLI_OPTIONAL,	// If the next digit is `len` then consume it and run the next `skip` steps, else skip them
+};
+
+enum {
+	GS1_LINTER_VLI_STORE_NONE,
+	GS1_LINTER_VLI_STORE_U8,	// Value of the field, to a uint8_t
+	GS1_LINTER_VLI_STORE_U16,	// Value of the field, to a uint16_t
+	GS1_LINTER_VLI_STORE_U32,	// Value of the field, to a uint32_t
+	GS1_LINTER_VLI_STORE_SPAN,	// Location of a non-empty field, to a gs1_parse_span_t
+	GS1_LINTER_VLI_STORE_DATE,	// YYMMDD date, to a gs1_parse_date_t
+	GS1_LINTER_VLI_STORE_FIELD,	// Presence of an optional block, as bit `len` of a uint16_t
+};
+
+#define GS1_LINTER_VLI_NINE_EMPTY	0x01	// VAR: A VLI of "9" indicates an empty field
+#define GS1_LINTER_VLI_NOT_BEFORE	0x02	// DATE: Must not precede the previous date
+
+#define GS1_LINTER_VLI_DIGITS(lo, hi)	(uint16_t)((2U << (hi)) - (1U << (lo)))
+
+typedef struct {
+	uint8_t op;		// GS1_LINTER_VLI_*
+	uint8_t len;		// Field length, amount added to the VLI, or optional block indicator
+	uint8_t skip;		// OPTIONAL: Number of steps in the block
+	uint8_t lint;		// One-based index of the linter applied to the field, or 0
+	uint16_t digits;	// DIGIT, VAR: Bit n set if digit n is permitted
+	uint8_t flags;		// GS1_LINTER_VLI_NINE_EMPTY, GS1_LINTER_VLI_NOT_BEFORE
+	uint8_t store;		// GS1_LINTER_VLI_STORE_*
+	uint16_t dest;		// Offset of the member of the output struct that receives the field
+	uint8_t missing;	// Error if the data ends before the step
+	uint8_t invalid;	// Error if the digit or date is invalid
+	uint8_t truncated;	// Error if the data ends within the field
+	uint8_t order;		// Error if a date precedes the previous date
+} gs1_lint_vli_step_t;
+
+
+/*
+ * The schema is a constant, so when the compiler is able to unroll the loop
+ * in gs1_lint_vli_run() completely it folds each step into straight-line code
+ * for the format, leaving only the branches that depend on the data.
+ * Otherwise the steps are interpreted, with the same result.
+ *
+ */
+#if defined(__GNUC__) && !defined(__OPTIMIZE_SIZE__) && (defined(__clang__) || __GNUC__ >= 8)
+#  define GS1_LINTER_UNROLL _Pragma("GCC unroll 64")
+#else
+#  define GS1_LINTER_UNROLL
+#endif
+
+
+/*
+ *  Record a field into the output struct according to the step.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE void gs1_lint_vli_store(const gs1_lint_vli_step_t* const s, const char* const data, const char* const p, const size_t len, void* const out)
+{
+
+	unsigned char* const dest = (unsigned char *)out + s->dest;
+
+	switch (s->store) {
+	case GS1_LINTER_VLI_STORE_U8:
+		*(uint8_t *)dest = (uint8_t)gs1_parse_digits(p, len);
+		break;
+	case GS1_LINTER_VLI_STORE_U16:
+		*(uint16_t *)(void *)dest = (uint16_t)gs1_parse_digits(p, len);
+		break;
+	case GS1_LINTER_VLI_STORE_U32:
+		*(uint32_t *)(void *)dest = (uint32_t)gs1_parse_digits(p, len);
+		break;
+	case GS1_LINTER_VLI_STORE_SPAN:
+		if (len) {
+			((gs1_parse_span_t *)(void *)dest)->pos = (uint16_t)(p - data);
+			((gs1_parse_span_t *)(void *)dest)->len = (uint16_t)len;
+		}
+		break;
+	case GS1_LINTER_VLI_STORE_DATE:
+		gs1_parse_date_fill((gs1_parse_date_t *)(void *)dest, gs1_lint_yy_to_year((int)gs1_parse_digits(p, 2)), p + 2);
+		break;
+	case GS1_LINTER_VLI_STORE_FIELD:
+		*(uint16_t *)(void *)dest |= (uint16_t)(1U << s->len);
+		break;
+	default:
+		break;
+	}
+
+}
+
+
+/*
+ *  Run the `num_steps` steps of a schema against the data, recording each
+ *  field into `out` if it is not NULL. `linters` are the linters referenced by
+ *  the steps.
+ *
+ *  The data must consist of digits only. Returns as for a linter, but without
+ *  updating the linter statistics.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t gs1_lint_vli_run(const gs1_lint_vli_step_t* const schema, const size_t num_steps, const gs1_linter_t* const linters, const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, void* const out)
+{
+
+/// \cond
+#define VLI_RETURN_ERROR(error, position, length) do {	\
+	if (err_pos) *err_pos = (size_t)(position);	\
+	if (err_len) *err_len = (size_t)(length);	\
+	return (gs1_lint_err_t)(error);			\
+} while (0)
+#define VLI_TRUNCATED(error) VLI_RETURN_ERROR(		\
+	error,						\
+	(p == q) ? 0         : p - data,		\
+	(p == q) ? q - data  : q - p			\
+)
+/// \endcond
+
+	const char *p = data;
+	const char* const q = data + data_len;
+	const char *block = data, *date = NULL, *date_block = NULL;
+	gs1_lint_err_t ret;
+	size_t i, len, resume = 0;
+
+	GS1_LINTER_UNROLL
+	for (i = 0; i < num_steps; i++) {
+
+		const gs1_lint_vli_step_t* const s = &schema[i];
+
+		/*
+		 * Steps within an optional block that is absent.
+		 *
+		 */
+		if (i < resume)
+			continue;
+
+		len = s->len;
+
+		if (s->op == GS1_LINTER_VLI_DIGIT) {
+			if (GS1_LINTER_UNLIKELY(p == q))
+				VLI_RETURN_ERROR(s->missing, 0, q - data);
+			if (GS1_LINTER_UNLIKELY(!(s->digits >> (*p - '0') & 1)))
+				VLI_RETURN_ERROR(s->invalid, p - data, 1);
+			len = 1;
+		} else if (s->op == GS1_LINTER_VLI_VAR) {
+			if (GS1_LINTER_UNLIKELY(p == q))
+				VLI_RETURN_ERROR(s->missing, 0, q - data);
+			if (GS1_LINTER_UNLIKELY(!(s->digits >> (*p - '0') & 1)))
+				VLI_RETURN_ERROR(s->invalid, p - data, 1);
+			len = (*p == '9' && (s->flags & GS1_LINTER_VLI_NINE_EMPTY)) ? 0 : (size_t)(*p - '0') + len;
+			if (GS1_LINTER_UNLIKELY((size_t)(q - ++p) < len))
+				VLI_TRUNCATED(s->truncated);
+			if (s->lint && len) {
+				ret = linters[s->lint - 1](p, len, err_pos, err_len);
+				if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+					VLI_RETURN_ERROR(ret, p - data, len);
+			}
+		} else if (s->op == GS1_LINTER_VLI_OPTIONAL) {
+			if (p == q || *p - '0' != s->len) {
+				resume = i + 1 + s->skip;
+				continue;
+			}
+			block = p++;
+			len = 0;
+		} else if (s->op == GS1_LINTER_VLI_FIXED) {
+			if (GS1_LINTER_UNLIKELY((size_t)(q - p) < len))
+				VLI_TRUNCATED(s->truncated);
+		} else {
+			assert(s->op == GS1_LINTER_VLI_DATE);
+			if (GS1_LINTER_UNLIKELY((size_t)(q - p) < 6))
+				VLI_TRUNCATED(s->truncated);
+			ret = linters[s->lint - 1](p, 6, err_pos, err_len);
+			if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+				VLI_RETURN_ERROR(s->invalid, p - data, 6);
+			if (GS1_LINTER_UNLIKELY((s->flags & GS1_LINTER_VLI_NOT_BEFORE) && date && memcmp(p, date, 6) > 0))
+				VLI_RETURN_ERROR(s->order, date_block - data, p + 6 - date_block);
+			date = p;
+			date_block = block;
+			len = 6;
+		}
+
+		if (out && s->store != GS1_LINTER_VLI_STORE_NONE)
+			gs1_lint_vli_store(s, data, p, len, out);
+
+		p += len;
+
+	}
+
+	if (GS1_LINTER_UNLIKELY(p != q))
+		VLI_RETURN_ERROR(GS1_LINTER_COUPON_EXCESS_DATA, p - data, q - p);
+
+	return GS1_LINTER_OK;
+
+#undef VLI_RETURN_ERROR
+#undef VLI_TRUNCATED
+
+}
+
+
+/*
+ *  The gs1_lint_*_valid() functions only report whether the data is valid, so
+ *  rather than stopping at the first invalid character they examine eight
+ *  characters at a time within a 64-bit word, testing each character against
+ *  the ranges of a character set without branching. The result is tested
+ *  once per word.
+ *
+ *  Defining GS1_LINTER_NO_VALID omits these variants, for builds that need
+ *  the position of an error.
+ *
+ */
+typedef struct {
+	unsigned char lo;
+	unsigned char hi;
+} gs1_lint_range_t;
+
+#define GS1_LINTER_SWAR_L UINT64_C(0x0101010101010101)
+#define GS1_LINTER_SWAR_H UINT64_C(0x8080808080808080)
+
+/*
+ *  Set the high bit of each byte of the word that lies within any of the
+ *  ranges, or of any byte that is 0x80 or above. The ranges must lie within
+ *  0x00 - 0x7F.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE uint64_t gs1_lint_swar_invalid(const uint64_t w, const gs1_lint_range_t* const ranges, const size_t num_ranges)
+{
+
+	const uint64_t low = w & ~GS1_LINTER_SWAR_H;
+	uint64_t in = 0;
+	size_t i;
+
+	/*
+	 *  With the high bit of each byte clear, no subtraction borrows from
+	 *  the neighbouring byte.
+	 *
+	 */
+	GS1_LINTER_UNROLL
+	for (i = 0; i < num_ranges; i++)
+		in |= ((low | GS1_LINTER_SWAR_H) - GS1_LINTER_SWAR_L * ranges[i].lo) &
+		      (GS1_LINTER_SWAR_L * (0x80U | ranges[i].hi) - low);
+
+	return (~in | w) & GS1_LINTER_SWAR_H;
+
+}
+
+/*
+ *  Determine whether every character of the data lies within one of the
+ *  ranges.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE bool gs1_lint_ranges_all(const gs1_lint_range_t* const ranges, const size_t num_ranges, const char* const data, const size_t data_len)
+{
+
+	size_t pos;
+	uint64_t w;
+
+	assert(data);
+
+	/*
+	 *  Data shorter than a word is padded with copies of its first
+	 *  character.
+	 *
+	 */
+	if (data_len < sizeof(w)) {
+		if (data_len == 0)
+			return true;
+		w = GS1_LINTER_SWAR_L * (unsigned char)data[0];
+		memcpy(&w, data, data_len);
+		return gs1_lint_swar_invalid(w, ranges, num_ranges) == 0;
+	}
+
+	for (pos = 0; data_len - pos > sizeof(w); pos += sizeof(w)) {
+		memcpy(&w, data + pos, sizeof(w));
+		if (GS1_LINTER_UNLIKELY(gs1_lint_swar_invalid(w, ranges, num_ranges)))
+			return false;
+	}
+
+	/*
+	 *  The final word overlaps characters that have already been checked.
+	 *
+	 */
+	memcpy(&w, data + data_len - sizeof(w), sizeof(w));
+
+	return gs1_lint_swar_invalid(w, ranges, num_ranges) == 0;
+
+}
+
+
+/*
+ * Linter functions by name, sorted by name. See gs1syntaxdictionary.c.
+ *
+ */
+struct name_function_s {
+	uint16_t name;		// Offset of the name within the name pool
+	gs1_linter_t fn;
+};
+
+extern const struct name_function_s name_function_map[];
+extern const size_t name_function_map_len;
+
+GS1_LINTER_INTERNAL const char* gs1_lint_name(size_t i);
+
+
+/*
+ * Validity-only variant of a character set linter. See
+ * gs1syntaxdictionary-valid.c.
+ *
+ */
+typedef bool (*gs1_lint_valid_fn_t)(const char *data, size_t data_len);
+
+GS1_LINTER_INTERNAL gs1_lint_valid_fn_t gs1_lint_valid_variant(gs1_linter_t linter);
+
+
+GS1_LINTER_INTERNAL char* gs1_lint_read_file(const char *path, size_t max_len, size_t *len);
+
+
+/*
+ * Epoch-based reclamation of runtime-replaceable data. See
+ * gs1syntaxdictionary-epoch.c.
+ *
+ */
+GS1_LINTER_INTERNAL void gs1_lint_epoch_enter(gs1_lint_epoch_guard_t *guard);
+GS1_LINTER_INTERNAL void gs1_lint_epoch_exit(const gs1_lint_epoch_guard_t *guard);
+GS1_LINTER_INTERNAL void gs1_lint_epoch_synchronize(void);
+
+
+/**
+ * @brief A runtime-loaded code list, held as a bit field over the domain of
+ * possible codes for the list.
+ *
+ */
+typedef struct {
+	size_t words;		///< Number of elements in `bits`.
+	uint64_t bits[];	///< Bit field with positions numbered from the MSB of the first element.
+} gs1_lint_codelist_table_t;
+
+GS1_LINTER_INTERNAL_VAR volatile long gs1_lint_codelists_active;
+
+GS1_LINTER_INTERNAL int gs1_lint_codelist_lookup(gs1_lint_codelist_t list, const char *data, size_t data_len, int *valid);
+
+
+/**
+ * @brief Consult any runtime-loaded replacement for a code list.
+ *
+ * Evaluates to non-zero if a runtime-loaded list is active, in which case
+ * `valid` is set according to the runtime list. Evaluates to zero, without
+ * touching `valid`, when the compiled-in list should be used.
+ *
+ * The check for whether any list has been loaded is a single load of a
+ * shared flag, so there is no measurable cost when the feature is unused.
+ * Defining GS1_LINTER_NO_CODELISTS removes the check entirely, for builds
+ * that omit gs1syntaxdictionary-codelist.c.
+ *
+ */
+#ifdef GS1_LINTER_NO_CODELISTS
+#define GS1_LINTER_CODELIST_LOOKUP(list, data, data_len, valid) 0
+#else
+#define GS1_LINTER_CODELIST_LOOKUP(list, data, data_len, valid)			\
+	(GS1_LINTER_UNLIKELY(GS1_LINTER_ATOMIC_LOAD(&gs1_lint_codelists_active) != 0) &&	\
+	 gs1_lint_codelist_lookup(list, data, data_len, &valid))
+#endif
+
 #endif  /* GS1_SYNTAXDICTIONARY_UTILS_H */
@@ -0,0 +1,123 @@
+/*
+ * GS1 Barcode Syntax Dictionary. Copyright (c) 2022-2026 GS1 AISBL.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file gs1syntaxdictionary-valid.c
+ *
+ * @brief Determination of whether data passes a linter, without locating the
+ * error.
+ *
+ * Where only pass or fail is needed, gs1_lint_valid() uses the validity-only
+ * variants of the character set linters, which check several characters at
+ * a time and do not locate the first invalid character.
+ *
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gs1syntaxdictionary.h"
+#include "gs1syntaxdictionary-utils.h"
+
+
+/*
+ * The validity-only variant of a linter, or NULL if it has none or the
+ * variants are omitted by GS1_LINTER_NO_VALID.
+ *
+ */
+GS1_LINTER_INTERNAL gs1_lint_valid_fn_t gs1_lint_valid_variant(const gs1_linter_t linter)
+{
+
+#ifndef GS1_LINTER_NO_VALID
+	static const struct {
+		gs1_linter_t linter;
+		gs1_lint_valid_fn_t valid;
+	} variants[] = {
+		{ gs1_lint_csetnumeric, gs1_lint_csetnumeric_valid },
+		{ gs1_lint_cset82, gs1_lint_cset82_valid },
+		{ gs1_lint_cset39, gs1_lint_cset39_valid },
+		{ gs1_lint_cset64, gs1_lint_cset64_valid },
+	};
+	size_t i;
+
+	for (i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+		if (linter == variants[i].linter)
+			return variants[i].valid;
+#else
+	(void)linter;
+#endif
+
+	return NULL;
+
+}
+
+
+/**
+ * Determine whether data passes a linter, without reporting where it fails.
+ *
+ * The character set linters are replaced by their validity-only variants,
+ * e.g. gs1_lint_cset82_valid(). Any other linter is called with no error
+ * position requested.
+ *
+ * @param [in] linter The linter to apply. Must not be `NULL`.
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ *
+ * @return `true` if the linter would return #GS1_LINTER_OK, otherwise `false`
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_valid(const gs1_linter_t linter, const char* const data, const size_t data_len)
+{
+
+	gs1_lint_valid_fn_t valid;
+
+	assert(linter);
+	assert(data);
+
+	valid = gs1_lint_valid_variant(linter);
+	if (valid)
+		return valid(data, data_len);
+
+	return linter(data, data_len, NULL, NULL) == GS1_LINTER_OK;
+
+}
+
+
+#ifdef UNIT_TESTS
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+void test_gs1_lint_valid(void)
+{
+
+	TEST_CHECK(gs1_lint_valid(gs1_lint_csetnumeric, "12345", 5));
+	TEST_CHECK(!gs1_lint_valid(gs1_lint_csetnumeric, "12A45", 5));
+	TEST_CHECK(gs1_lint_valid(gs1_lint_cset82, "AB-12", 5));
+	TEST_CHECK(!gs1_lint_valid(gs1_lint_cset82, "AB 12", 5));
+	TEST_CHECK(gs1_lint_valid(gs1_lint_cset39, "AB-12", 5));
+	TEST_CHECK(!gs1_lint_valid(gs1_lint_cset39, "ab-12", 5));
+	TEST_CHECK(gs1_lint_valid(gs1_lint_cset64, "AB1=", 3));
+	TEST_CHECK(!gs1_lint_valid(gs1_lint_cset64, "AB1=", 4));
+	TEST_CHECK(gs1_lint_valid(gs1_lint_csum, "09501101530003", 14));
+	TEST_CHECK(!gs1_lint_valid(gs1_lint_csum, "09501101530009", 14));
+
+}
+
+#endif  /* UNIT_TESTS */
@@ -22,13 +22,84 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-struct name_function_s {
-	char *name;
-	gs1_linter_t fn;
-};
+/*
+ * All linters, sorted by name.
+ *
+ * A build may instead provide a subset of the linters by setting
+ * GS1_LINTER_CUSTOM_LINTERS_H to the name of a header file that defines
+ * GS1_LINTERS, as is done by "make minimal".
+ *
+ */
+#ifdef GS1_LINTER_CUSTOM_LINTERS_H
+#define xstr(s) str(s)
+#define str(s) #s
+#include xstr(GS1_LINTER_CUSTOM_LINTERS_H)
+#else
+#define GS1_LINTERS(ENT, DEP) \
+	ENT(couponcode) \
+	ENT(couponposoffer) \
+	ENT(cset39) \
+	ENT(cset64) \
+	ENT(cset82) \
+	ENT(csetnumeric) \
+	ENT(csum) \
+	ENT(csumalpha) \
+	ENT(gcppos1) \
+	ENT(gcppos2) \
+	ENT(hasnondigit) \
+	ENT(hh) \
+	ENT(hhmi) \
+	DEP(hhmm) \
+	ENT(hyphen) \
+	ENT(iban) \
+	ENT(importeridx) \
+	ENT(iso3166) \
+	ENT(iso3166999) \
+	ENT(iso3166alpha2) \
+	DEP(iso3166list) \
+	ENT(iso4217) \
+	ENT(iso5218) \
+	DEP(key) \
+	DEP(keyoff1) \
+	ENT(latitude) \
+	ENT(longitude) \
+	ENT(mediatype) \
+	ENT(mi) \
+	DEP(mmoptss) \
+	ENT(nonzero) \
+	ENT(nozeroprefix) \
+	ENT(packagetype) \
+	ENT(pcenc) \
+	ENT(pieceoftotal) \
+	ENT(posinseqslash) \
+	ENT(ss) \
+	ENT(winding) \
+	ENT(yesno) \
+	ENT(yymmd0) \
+	ENT(yymmdd) \
+	DEP(yymmddhh) \
+	ENT(yyyymmd0) \
+	ENT(yyyymmdd) \
+	ENT(zero)
+#endif
 
 
-#define ENT(x) { .name = #x, .fn = gs1_lint_##x }
+/*
+ * Linter names are held in a single string pool and referenced from
+ * name_function_map by 16-bit offset, so that only the function pointers
+ * require load-time relocation.
+ *
+ */
+#define NAME(x) char x[sizeof(#x)];
+struct name_pool_s { GS1_LINTERS(NAME, NAME) };
+#undef NAME
+
+#define NAME(x) #x,
+static const struct name_pool_s name_pool = { GS1_LINTERS(NAME, NAME) };
+#undef NAME
+
+
+#define ENT(x) { .name = (uint16_t)offsetof(struct name_pool_s, x), .fn = gs1_lint_##x },
 #define DEP(x)					\
 DIAG_PUSH					\
 DIAG_DISABLE_DEPRECATED_DECLARATIONS		\
@@ -44,51 +115,7 @@ DIAG_POP
 #endif
 
 const struct name_function_s name_function_map[] = {
-	ENT(couponcode),
-	ENT(couponposoffer),
-	ENT(cset39),
-	ENT(cset64),
-	ENT(cset82),
-	ENT(csetnumeric),
-	ENT(csum),
-	ENT(csumalpha),
-	ENT(gcppos1),
-	ENT(gcppos2),
-	ENT(hasnondigit),
-	ENT(hh),
-	ENT(hhmi),
-	DEP(hhmm),
-	ENT(hyphen),
-	ENT(iban),
-	ENT(importeridx),
-	ENT(iso3166),
-	ENT(iso3166999),
-	ENT(iso3166alpha2),
-	DEP(iso3166list),
-	ENT(iso4217),
-	ENT(iso5218),
-	DEP(key),
-	DEP(keyoff1),
-	ENT(latitude),
-	ENT(longitude),
-	ENT(mediatype),
-	ENT(mi),
-	DEP(mmoptss),
-	ENT(nonzero),
-	ENT(nozeroprefix),
-	ENT(packagetype),
-	ENT(pcenc),
-	ENT(pieceoftotal),
-	ENT(posinseqslash),
-	ENT(ss),
-	ENT(winding),
-	ENT(yesno),
-	ENT(yymmd0),
-	ENT(yymmdd),
-	DEP(yymmddhh),
-	ENT(yyyymmd0),
-	ENT(yyyymmdd),
-	ENT(zero),
+	GS1_LINTERS(ENT, DEP)
 };
 
 /* Flaky GCC */
@@ -99,6 +126,18 @@ const struct name_function_s name_function_map[] = {
 #undef ENT
 #undef DEP
 
+const size_t name_function_map_len = sizeof(name_function_map) / sizeof(name_function_map[0]);
+
+
+/*
+ * Return the name of the linter at the given index of name_function_map.
+ *
+ */
+GS1_LINTER_INTERNAL const char* gs1_lint_name(const size_t i)
+{
+	return (const char *)&name_pool + name_function_map[i].name;
+}
+
 
 /*
  * Return the linter function corresponding to a linter name.
@@ -111,7 +150,7 @@ gs1_linter_t gs1_linter_from_name(const char* const name) {
 	while (s < e) {
 
 		const size_t m = s + (e - s) / 2;
-		const int cmp = strcmp(name_function_map[m].name, name);
+		const int cmp = strcmp(gs1_lint_name(m), name);
 
 		if (cmp == 0)
 			return name_function_map[m].fn;
@@ -136,132 +175,187 @@ gs1_linter_t gs1_linter_from_name(const char* const name) {
  */
 #ifdef GS1_LINTER_ERR_STR_EN
 
-GS1_SYNTAX_DICTIONARY_API const char *gs1_lint_err_str[] = {
-	"No issues were detected by the linter.",
-	"A non-digit character was found where a digit is expected.",
-	"A non-CSET 82 character was found where a CSET 82 character is expected.",
-	"A non-CSET 39 character was found where a CSET 39 character is expected.",
-	"A non-CSET 32 character was found where a CSET 32 character is expected.",
-	"The numeric check digit is incorrect.",
-	"The component is too short to perform a numeric check digit calculation.",
-	"The alphanumeric check-character pair are incorrect.",
-	"The component is too short to perform an alphanumeric check character pair calculation.",
-	"The component is too long to perform an alphanumeric check character pair calculation.",
-	"The data source for GCP lookups is offline.",
-	"",	// Unused
-	"The GS1 Company Prefix is invalid.",
-	"The Importer Index must be a single character.",
-	"The Importer Index is an invalid character.",
-	"A non-zero value is required.",
-	"A zero is required.",
-	"A zero prefix is not permitted.",
-	"A \"0\" or \"1\" is required.",
-	"The winding direction must be either \"0\", \"1\" or \"9\".",
-	"A valid ISO 3166 three-digit country code is required.",
-	"A valid ISO 3166 three-digit country code or \"999\" is required.",
-	"A valid ISO 3166 two-character country code is required.",
-	"A valid ISO 4217 three-digit currency code is required.",
-	"The IBAN is too short.",
-	"The IBAN contains an invalid character.",
-	"The IBAN must start with a valid ISO 3166 two-character country code.",
-	"The IBAN is invalid since the check characters are incorrect.",
-	"The date is too short.",
-	"The date is too long.",
-	"",	// Unused
-	"",	// Unused
-	"",	// Unused
-	"The hour with minute is too short for HHMI format.",
-	"The hour with minute is too long for HHMI format.",
-	"",	// Unused
-	"The date contains an illegal month of the year.",
-	"The date contains an illegal day of the month.",
-	"The time contains an illegal hour.",
-	"The time contains an illegal minute.",
-	"The time contains an illegal seconds.",
-	"The piece with total must have an even length, having equal-length components.",
-	"The piece number must not have a value of zero.",
-	"The piece total must not have a value of zero.",
-	"The piece number must not exceed the piece total.",
-	"The input contains an invalid percent hex-encoding \"%hh\" sequence.",
-	"The coupon's Format Code is missing.",
-	"The coupon's Format Code must be \"0\" or \"1\".",
-	"The coupon's Funder VLI is missing.",
-	"The coupon's Funder VLI must be \"0\" to \"6\".",
-	"The coupon's Funder is shorter than what is indicated by its VLI.",
-	"The coupon's Offer Code is shorter than the required six digits.",
-	"The coupon's Serial Number VLI is missing.",
-	"The coupon's Serial Number is shorter than what is indicated by its VLI.",
-	"The coupon's primary GS1 Company Prefix VLI is missing.",
-	"The coupon's primary GS1 Company Prefix VLI must be \"0\" to \"6\".",
-	"The coupon's primary GS1 Company Prefix is shorter than what is indicated by its VLI.",
-	"The coupon's Save Value VLI is missing.",
-	"The coupon's Save Value VLI must be \"1\" to \"5\".",
-	"The coupon's Save Value is shorter than what is indicated by its VLI.",
-	"The coupon's primary purchase Requirement VLI is missing.",
-	"The coupon's primary purchase Requirement VLI must be \"1\" to \"5\".",
-	"The coupon's primary purchase Requirement is shorter than what is indicated by its VLI.",
-	"The coupon's primary purchase Requirement Code is missing.",
-	"The coupon's primary purchase Requirement Code must be \"0\" to \"4\" or \"9\".",
-	"The coupon's primary purchase Family Code is shorter than the required three digits.",
-	"The coupon's Additional Purchase Rules Code is missing.",
-	"The coupon's Additional Purchase Rules Code must be \"0\" to \"3\".",
-	"The coupon's second purchase Requirement VLI is missing.",
-	"The coupon's second purchase Requirement VLI must be \"1\" to \"5\".",
-	"The coupon's second purchase Requirement is shorter than what is indicated by its VLI.",
-	"The coupon's second purchase Requirement Code is missing.",
-	"The coupon's second purchase Requirement Code must be \"0\" to \"4\" or \"9\".",
-	"The coupon's second purchase Family Code is shorter than the required three digits.",
-	"The coupon's second purchase GS1 Company Prefix VLI is missing.",
-	"The coupon's second purchase GS1 Company Prefix VLI must be \"0\" to \"6\" or \"9\".",
-	"The coupon's second purchase GS1 Company Prefix is shorter than what is indicated by its VLI.",
-	"The coupon's third purchase Requirement VLI is missing.",
-	"The coupon's third purchase Requirement VLI must be \"1\" to \"5\".",
-	"The coupon's third purchase Requirement is shorter than what is indicated by its VLI.",
-	"The coupon's third purchase Requirement Code is missing.",
-	"The coupon's third purchase Requirement Code must be \"0\" to \"4\" or \"9\".",
-	"The coupon's third purchase Family Code is shorter than the required three digits.",
-	"The coupon's third purchase GS1 Company Prefix VLI is missing.",
-	"The coupon's third purchase GS1 Company Prefix VLI must be \"0\" to \"6\" or \"9\".",
-	"The coupon's third purchase GS1 Company Prefix is shorter than what is indicated by its VLI.",
-	"The coupon's expiration date is too short for YYMMDD format.",
-	"The coupon's expiration date is invalid.",
-	"The coupon's start date is too short to YYMMDD format.",
-	"The coupon's start date is invalid.",
-	"The coupon's expiration date precede the start date.",
-	"The coupon's Retailer GCP/GLN VLI is missing.",
-	"The coupon's Retailer GCP/GLN VLI must be \"1\" to \"7\".",
-	"The coupon's Retailer GCP/GLN is shorter than what is indicated by its VLI.",
-	"The coupon's Save Value Code is missing.",
-	"The coupon's Save Value Code must be \"0\", \"1\", \"2\", \"5\" or \"6\".",
-	"The coupon's Save Value Applies to Item is missing.",
-	"The coupon's Save Value Applies to Item must be \"0\" to \"2\".",
-	"The coupon's Store Coupon Flag is missing.",
-	"The coupon's Don't Multiply Flag is missing.",
-	"The coupon's Don't Multiply Flag must be \"0\" or \"1\".",
-	"The coupon contains excess data after the recognised optional fields.",
-	"",	// Unused
-	"The latitude is outside of the range \"0000000000\" to \"1800000000\".",
-	"The longitude is outside of the range \"0000000000\" to \"3600000000\".",
-	"A valid AIDC media type is required.",
-	"The latitude must be 10 digits.",
-	"The longitude must be 10 digits.",
-	"A non-CSET 64 character was found where a CSET 64 character is expected.",
-	"Incorrect number of CSET 64 pad characters.",
-	"Only hyphens are permitted.",
-	"A valid ISO/IEC 5218 biological sex code required.",
-	"The data must have the format \"<pos>/<end>\".",
-	"The position number must not exceed the end number.",
-	"A non-digit character is required.",
-	"The hour is too short for HH format.",
-	"The hour is too long for HH format.",
-	"The minute is too short for MI format.",
-	"The minute is too long for MI format.",
-	"The second is too short for SS format.",
-	"The second is too long for SS format.",
-	"A valid PackageTypeCode is required.",
-	"The component is shorter than the minimum length GS1 Company Prefix.",
-	"The IBAN is too long.",
-};
+#define GS1_LINTER_ERR_STRS_EN(X) \
+	X(GS1_LINTER_OK, "No issues were detected by the linter.") \
+	X(GS1_LINTER_NON_DIGIT_CHARACTER, "A non-digit character was found where a digit is expected.") \
+	X(GS1_LINTER_INVALID_CSET82_CHARACTER, "A non-CSET 82 character was found where a CSET 82 character is expected.") \
+	X(GS1_LINTER_INVALID_CSET39_CHARACTER, "A non-CSET 39 character was found where a CSET 39 character is expected.") \
+	X(GS1_LINTER_INVALID_CSET32_CHARACTER, "A non-CSET 32 character was found where a CSET 32 character is expected.") \
+	X(GS1_LINTER_INCORRECT_CHECK_DIGIT, "The numeric check digit is incorrect.") \
+	X(GS1_LINTER_TOO_SHORT_FOR_CHECK_DIGIT, "The component is too short to perform a numeric check digit calculation.") \
+	X(GS1_LINTER_INCORRECT_CHECK_PAIR, "The alphanumeric check-character pair are incorrect.") \
+	X(GS1_LINTER_TOO_SHORT_FOR_CHECK_PAIR, "The component is too short to perform an alphanumeric check character pair calculation.") \
+	X(GS1_LINTER_TOO_LONG_FOR_CHECK_PAIR_IMPLEMENTATION, "The component is too long to perform an alphanumeric check character pair calculation.") \
+	X(GS1_LINTER_GCP_DATASOURCE_OFFLINE, "The data source for GCP lookups is offline.") \
+	X(GS1_LINTER_UNUSED_6, "") \
+	X(GS1_LINTER_INVALID_GCP_PREFIX, "The GS1 Company Prefix is invalid.") \
+	X(GS1_LINTER_IMPORTER_IDX_MUST_BE_ONE_CHARACTER, "The Importer Index must be a single character.") \
+	X(GS1_LINTER_INVALID_IMPORT_IDX_CHARACTER, "The Importer Index is an invalid character.") \
+	X(GS1_LINTER_ILLEGAL_ZERO_VALUE, "A non-zero value is required.") \
+	X(GS1_LINTER_NOT_ZERO, "A zero is required.") \
+	X(GS1_LINTER_ILLEGAL_ZERO_PREFIX, "A zero prefix is not permitted.") \
+	X(GS1_LINTER_NOT_ZERO_OR_ONE, "A \"0\" or \"1\" is required.") \
+	X(GS1_LINTER_INVALID_WINDING_DIRECTION, "The winding direction must be either \"0\", \"1\" or \"9\".") \
+	X(GS1_LINTER_NOT_ISO3166, "A valid ISO 3166 three-digit country code is required.") \
+	X(GS1_LINTER_NOT_ISO3166_OR_999, "A valid ISO 3166 three-digit country code or \"999\" is required.") \
+	X(GS1_LINTER_NOT_ISO3166_ALPHA2, "A valid ISO 3166 two-character country code is required.") \
+	X(GS1_LINTER_NOT_ISO4217, "A valid ISO 4217 three-digit currency code is required.") \
+	X(GS1_LINTER_IBAN_TOO_SHORT, "The IBAN is too short.") \
+	X(GS1_LINTER_INVALID_IBAN_CHARACTER, "The IBAN contains an invalid character.") \
+	X(GS1_LINTER_ILLEGAL_IBAN_COUNTRY_CODE, "The IBAN must start with a valid ISO 3166 two-character country code.") \
+	X(GS1_LINTER_INCORRECT_IBAN_CHECKSUM, "The IBAN is invalid since the check characters are incorrect.") \
+	X(GS1_LINTER_DATE_TOO_SHORT, "The date is too short.") \
+	X(GS1_LINTER_DATE_TOO_LONG, "The date is too long.") \
+	X(GS1_LINTER_UNUSED_2, "") \
+	X(GS1_LINTER_UNUSED_3, "") \
+	X(GS1_LINTER_UNUSED_5, "") \
+	X(GS1_LINTER_HOUR_WITH_MINUTE_TOO_SHORT, "The hour with minute is too short for HHMI format.") \
+	X(GS1_LINTER_HOUR_WITH_MINUTE_TOO_LONG, "The hour with minute is too long for HHMI format.") \
+	X(GS1_LINTER_UNUSED_4, "") \
+	X(GS1_LINTER_ILLEGAL_MONTH, "The date contains an illegal month of the year.") \
+	X(GS1_LINTER_ILLEGAL_DAY, "The date contains an illegal day of the month.") \
+	X(GS1_LINTER_ILLEGAL_HOUR, "The time contains an illegal hour.") \
+	X(GS1_LINTER_ILLEGAL_MINUTE, "The time contains an illegal minute.") \
+	X(GS1_LINTER_ILLEGAL_SECOND, "The time contains an illegal seconds.") \
+	X(GS1_LINTER_INVALID_LENGTH_FOR_PIECE_OF_TOTAL, "The piece with total must have an even length, having equal-length components.") \
+	X(GS1_LINTER_ZERO_PIECE_NUMBER, "The piece number must not have a value of zero.") \
+	X(GS1_LINTER_ZERO_TOTAL_PIECES, "The piece total must not have a value of zero.") \
+	X(GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL, "The piece number must not exceed the piece total.") \
+	X(GS1_LINTER_INVALID_PERCENT_SEQUENCE, "The input contains an invalid percent hex-encoding \"%hh\" sequence.") \
+	X(GS1_LINTER_COUPON_MISSING_FORMAT_CODE, "The coupon's Format Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_FORMAT_CODE, "The coupon's Format Code must be \"0\" or \"1\".") \
+	X(GS1_LINTER_COUPON_MISSING_FUNDER_VLI, "The coupon's Funder VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_FUNDER_LENGTH, "The coupon's Funder VLI must be \"0\" to \"6\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_FUNDER, "The coupon's Funder is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_TRUNCATED_OFFER_CODE, "The coupon's Offer Code is shorter than the required six digits.") \
+	X(GS1_LINTER_COUPON_MISSING_SERIAL_NUMBER_VLI, "The coupon's Serial Number VLI is missing.") \
+	X(GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER, "The coupon's Serial Number is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_GCP_VLI, "The coupon's primary GS1 Company Prefix VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_GCP_LENGTH, "The coupon's primary GS1 Company Prefix VLI must be \"0\" to \"6\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_GCP, "The coupon's primary GS1 Company Prefix is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_SAVE_VALUE_VLI, "The coupon's Save Value VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_SAVE_VALUE_LENGTH, "The coupon's Save Value VLI must be \"1\" to \"5\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_SAVE_VALUE, "The coupon's Save Value is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_1ST_PURCHASE_REQUIREMENT_VLI, "The coupon's primary purchase Requirement VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_1ST_PURCHASE_REQUIREMENT_LENGTH, "The coupon's primary purchase Requirement VLI must be \"1\" to \"5\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_1ST_PURCHASE_REQUIREMENT, "The coupon's primary purchase Requirement is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_1ST_PURCHASE_REQUIREMENT_CODE, "The coupon's primary purchase Requirement Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_1ST_PURCHASE_REQUIREMENT_CODE, "The coupon's primary purchase Requirement Code must be \"0\" to \"4\" or \"9\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_1ST_PURCHASE_FAMILY_CODE, "The coupon's primary purchase Family Code is shorter than the required three digits.") \
+	X(GS1_LINTER_COUPON_MISSING_ADDITIONAL_PURCHASE_RULES_CODE, "The coupon's Additional Purchase Rules Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_ADDITIONAL_PURCHASE_RULES_CODE, "The coupon's Additional Purchase Rules Code must be \"0\" to \"3\".") \
+	X(GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_REQUIREMENT_VLI, "The coupon's second purchase Requirement VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_REQUIREMENT_LENGTH, "The coupon's second purchase Requirement VLI must be \"1\" to \"5\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_REQUIREMENT, "The coupon's second purchase Requirement is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_REQUIREMENT_CODE, "The coupon's second purchase Requirement Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_REQUIREMENT_CODE, "The coupon's second purchase Requirement Code must be \"0\" to \"4\" or \"9\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_FAMILY_CODE, "The coupon's second purchase Family Code is shorter than the required three digits.") \
+	X(GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_GCP_VLI, "The coupon's second purchase GS1 Company Prefix VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_GCP_LENGTH, "The coupon's second purchase GS1 Company Prefix VLI must be \"0\" to \"6\" or \"9\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_GCP, "The coupon's second purchase GS1 Company Prefix is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_REQUIREMENT_VLI, "The coupon's third purchase Requirement VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_REQUIREMENT_LENGTH, "The coupon's third purchase Requirement VLI must be \"1\" to \"5\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_REQUIREMENT, "The coupon's third purchase Requirement is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_REQUIREMENT_CODE, "The coupon's third purchase Requirement Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_REQUIREMENT_CODE, "The coupon's third purchase Requirement Code must be \"0\" to \"4\" or \"9\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_FAMILY_CODE, "The coupon's third purchase Family Code is shorter than the required three digits.") \
+	X(GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_GCP_VLI, "The coupon's third purchase GS1 Company Prefix VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_GCP_LENGTH, "The coupon's third purchase GS1 Company Prefix VLI must be \"0\" to \"6\" or \"9\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_GCP, "The coupon's third purchase GS1 Company Prefix is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_TOO_SHORT_FOR_EXPIRATION_DATE, "The coupon's expiration date is too short for YYMMDD format.") \
+	X(GS1_LINTER_COUPON_INVALID_EXIPIRATION_DATE, "The coupon's expiration date is invalid.") \
+	X(GS1_LINTER_COUPON_TOO_SHORT_FOR_START_DATE, "The coupon's start date is too short to YYMMDD format.") \
+	X(GS1_LINTER_COUPON_INVALID_START_DATE, "The coupon's start date is invalid.") \
+	X(GS1_LINTER_COUPON_EXPIRATION_BEFORE_START, "The coupon's expiration date precede the start date.") \
+	X(GS1_LINTER_COUPON_MISSING_RETAILER_GCP_OR_GLN_VLI, "The coupon's Retailer GCP/GLN VLI is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_RETAILER_GCP_OR_GLN_LENGTH, "The coupon's Retailer GCP/GLN VLI must be \"1\" to \"7\".") \
+	X(GS1_LINTER_COUPON_TRUNCATED_RETAILER_GCP_OR_GLN, "The coupon's Retailer GCP/GLN is shorter than what is indicated by its VLI.") \
+	X(GS1_LINTER_COUPON_MISSING_SAVE_VALUE_CODE, "The coupon's Save Value Code is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_SAVE_VALUE_CODE, "The coupon's Save Value Code must be \"0\", \"1\", \"2\", \"5\" or \"6\".") \
+	X(GS1_LINTER_COUPON_MISSING_SAVE_VALUE_APPLIES_TO_ITEM, "The coupon's Save Value Applies to Item is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_SAVE_VALUE_APPLIES_TO_ITEM, "The coupon's Save Value Applies to Item must be \"0\" to \"2\".") \
+	X(GS1_LINTER_COUPON_MISSING_STORE_COUPON_FLAG, "The coupon's Store Coupon Flag is missing.") \
+	X(GS1_LINTER_COUPON_MISSING_DONT_MULTIPLY_FLAG, "The coupon's Don't Multiply Flag is missing.") \
+	X(GS1_LINTER_COUPON_INVALID_DONT_MULTIPLY_FLAG, "The coupon's Don't Multiply Flag must be \"0\" or \"1\".") \
+	X(GS1_LINTER_COUPON_EXCESS_DATA, "The coupon contains excess data after the recognised optional fields.") \
+	X(GS1_LINTER_UNUSED_1, "") \
+	X(GS1_LINTER_INVALID_LATITUDE, "The latitude is outside of the range \"0000000000\" to \"1800000000\".") \
+	X(GS1_LINTER_INVALID_LONGITUDE, "The longitude is outside of the range \"0000000000\" to \"3600000000\".") \
+	X(GS1_LINTER_INVALID_MEDIA_TYPE, "A valid AIDC media type is required.") \
+	X(GS1_LINTER_LATITUDE_INVALID_LENGTH, "The latitude must be 10 digits.") \
+	X(GS1_LINTER_LONGITUDE_INVALID_LENGTH, "The longitude must be 10 digits.") \
+	X(GS1_LINTER_INVALID_CSET64_CHARACTER, "A non-CSET 64 character was found where a CSET 64 character is expected.") \
+	X(GS1_LINTER_INVALID_CSET64_PADDING, "Incorrect number of CSET 64 pad characters.") \
+	X(GS1_LINTER_NOT_HYPHEN, "Only hyphens are permitted.") \
+	X(GS1_LINTER_INVALID_BIOLOGICAL_SEX_CODE, "A valid ISO/IEC 5218 biological sex code required.") \
+	X(GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED, "The data must have the format \"<pos>/<end>\".") \
+	X(GS1_LINTER_POSITION_EXCEEDS_END, "The position number must not exceed the end number.") \
+	X(GS1_LINTER_REQUIRES_NON_DIGIT_CHARACTER, "A non-digit character is required.") \
+	X(GS1_LINTER_HOUR_TOO_SHORT, "The hour is too short for HH format.") \
+	X(GS1_LINTER_HOUR_TOO_LONG, "The hour is too long for HH format.") \
+	X(GS1_LINTER_MINUTE_TOO_SHORT, "The minute is too short for MI format.") \
+	X(GS1_LINTER_MINUTE_TOO_LONG, "The minute is too long for MI format.") \
+	X(GS1_LINTER_SECOND_TOO_SHORT, "The second is too short for SS format.") \
+	X(GS1_LINTER_SECOND_TOO_LONG, "The second is too long for SS format.") \
+	X(GS1_LINTER_INVALID_PACKAGE_TYPE, "A valid PackageTypeCode is required.") \
+	X(GS1_LINTER_TOO_SHORT_FOR_GCP, "The component is shorter than the minimum length GS1 Company Prefix.") \
+	X(GS1_LINTER_IBAN_TOO_LONG, "The IBAN is too long.")
+
+
+/*
+ * The strings are held in a single pool and located by a table of 16-bit
+ * offsets, so that neither requires load-time relocation.
+ *
+ */
+#define X(e, s) char e[sizeof(s)];
+struct err_str_pool_s { GS1_LINTER_ERR_STRS_EN(X) };
+#undef X
+
+#define X(e, s) s,
+static const struct err_str_pool_s err_str_pool = { GS1_LINTER_ERR_STRS_EN(X) };
+#undef X
+
+#define X(e, s) (uint16_t)offsetof(struct err_str_pool_s, e),
+static const uint16_t err_str_offsets[] = { GS1_LINTER_ERR_STRS_EN(X) };
+#undef X
+
+
+/**
+ * @brief Return a friendly English message for a linter return code.
+ *
+ * Unlike the ::gs1_lint_err_str array, the messages are served from a string
+ * pool that requires no load-time relocations.
+ *
+ * @param [in] err A ::gs1_lint_err_t value returned by a linter.
+ *
+ * @return the message, an empty string for an unused code, or NULL if err is
+ *         out of range
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API const char* gs1_lint_err_msg(const gs1_lint_err_t err)
+{
+
+	if ((size_t)err >= sizeof(err_str_offsets) / sizeof(err_str_offsets[0]))
+		return NULL;
+
+	return (const char *)&err_str_pool + err_str_offsets[err];
+
+}
+
+
+#ifndef GS1_LINTER_ERR_STR_NO_ARRAY
+
+/*
+ * Retained for compatibility. Each entry requires a load-time relocation; new
+ * code should prefer gs1_lint_err_msg().
+ *
+ */
+#define X(e, s) err_str_pool.e,
+GS1_SYNTAX_DICTIONARY_API const char *gs1_lint_err_str[] = { GS1_LINTER_ERR_STRS_EN(X) };
+#undef X
+
+#endif  /* GS1_LINTER_ERR_STR_NO_ARRAY */
+
 
 #endif  /* GS1_LINTER_ERR_STR_EN */
 
@@ -278,9 +372,13 @@ void test_name_function_map_is_sorted(void)
 	size_t i;
 
 	for (i = 1; i < sizeof(name_function_map) / sizeof(name_function_map[0]); i++) {
-		TEST_CHECK(strcmp(name_function_map[i].name, name_function_map[i-1].name) > 0);
+		TEST_CHECK(strcmp(gs1_lint_name(i), gs1_lint_name(i-1)) > 0);
 	}
 
+	TEST_CHECK(sizeof(name_pool) < 65536);
+	TEST_CHECK(strcmp(gs1_lint_name(0), "couponcode") == 0);
+	TEST_CHECK(strcmp(gs1_lint_name(name_function_map_len - 1), "zero") == 0);
+
 }
 
 void test_gs1_linter_from_name(void)
@@ -301,6 +399,23 @@ void test_gs1_linter_err_str_en_size(void)
 {
 	TEST_CHECK(sizeof(gs1_lint_err_str)/sizeof(gs1_lint_err_str[0]) == __GS1_LINTER_NUM_ERRS);
 }
+
+void test_gs1_lint_err_msg(void)
+{
+
+	int i;
+
+	TEST_CHECK(sizeof(err_str_pool) < 65536);
+
+	for (i = 0; i < __GS1_LINTER_NUM_ERRS; i++)
+		TEST_CHECK(gs1_lint_err_msg((gs1_lint_err_t)i) == gs1_lint_err_str[i]);
+
+	TEST_CHECK(strcmp(gs1_lint_err_msg(GS1_LINTER_OK), "No issues were detected by the linter.") == 0);
+	TEST_CHECK(strcmp(gs1_lint_err_msg(GS1_LINTER_UNUSED_1), "") == 0);
+	TEST_CHECK(strcmp(gs1_lint_err_msg(GS1_LINTER_IBAN_TOO_LONG), "The IBAN is too long.") == 0);
+	TEST_CHECK(gs1_lint_err_msg(__GS1_LINTER_NUM_ERRS) == NULL);
+
+}
 #endif
 
 #endif  /* UNIT_TESTS */
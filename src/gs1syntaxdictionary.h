@@ -37,7 +37,9 @@
 #define GS1_SYNTAXDICTIONARY_H
 
 /// \cond
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -207,13 +209,32 @@ typedef enum
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wignored-attributes"
 #endif
+#ifndef GS1_LINTER_ERR_STR_NO_ARRAY
 GS1_SYNTAX_DICTIONARY_API extern const char *gs1_lint_err_str[];
+#endif
 #ifdef __EMSCRIPTEN__
 #pragma clang diagnostic pop
 #endif
+GS1_SYNTAX_DICTIONARY_API const char* gs1_lint_err_msg(gs1_lint_err_t err);
 #endif
 
 
+/**
+ * @brief Code lists used by the reference linters that may be replaced at
+ * runtime using gs1_lint_codelist_load().
+ *
+ */
+typedef enum
+{
+	GS1_LINTER_CODELIST_ISO3166 = 0,				///< ISO 3166 "num-3" country codes, used by `iso3166` and `iso3166999`.
+	GS1_LINTER_CODELIST_ISO3166ALPHA2,				///< ISO 3166 "alpha-2" country codes, used by `iso3166alpha2` and `iban`.
+	GS1_LINTER_CODELIST_ISO4217,					///< ISO 4217 three-digit currency codes, used by `iso4217`.
+	GS1_LINTER_CODELIST_MEDIA_TYPE,					///< AIDC media types, used by `mediatype`.
+	GS1_LINTER_CODELIST_PACKAGE_TYPE,				///< PackageTypeCode values, used by `packagetype`.
+	__GS1_LINTER_CODELIST_NUM					//  Keep this as the last element which captures the size of this enumeration.
+} gs1_lint_codelist_t;
+
+
 /**
  * @brief Type specification for all linter functions.
  *
@@ -221,6 +242,399 @@ GS1_SYNTAX_DICTIONARY_API extern const char *gs1_lint_err_str[];
 typedef gs1_lint_err_t (*gs1_linter_t)(const char *data, size_t data_len, size_t *err_pos, size_t *err_len);
 
 
+/**
+ * @brief Maximum length of component data that can be held by a deferred
+ * revalidation queue entry.
+ *
+ */
+#define GS1_LINTER_REVALIDATE_MAX_DATA_LEN 90
+
+
+/**
+ * @brief A component awaiting revalidation once the GCP data source is
+ * available.
+ *
+ */
+typedef struct {
+	gs1_linter_t linter;					///< Linter that reported the data source as offline.
+	void *user;						///< Caller value identifying the message.
+	size_t offset;						///< Position of the component within the message.
+	size_t data_len;					///< Length of the component data.
+	char data[GS1_LINTER_REVALIDATE_MAX_DATA_LEN];		///< Copy of the component data.
+} gs1_lint_revalidate_item_t;
+
+
+/**
+ * @brief A bounded FIFO queue of components awaiting revalidation, held in
+ * caller-provided storage.
+ *
+ */
+typedef struct {
+	gs1_lint_revalidate_item_t *items;			///< Storage for the pending items.
+	size_t capacity;					///< Number of entries in the storage.
+	size_t head;						///< Index of the oldest pending item.
+	size_t count;						///< Number of pending items.
+} gs1_lint_revalidate_queue_t;
+
+
+/**
+ * @brief Type specification for the callback that receives the final outcome
+ * of a revalidated component.
+ *
+ */
+typedef void (*gs1_lint_revalidate_cb_t)(void *ctx, void *user, size_t offset, const char *data, size_t data_len, gs1_lint_err_t err, size_t err_pos, size_t err_len);
+
+
+/**
+ * @brief Maximum number of components in the specification of a Syntax
+ * Dictionary entry.
+ *
+ */
+#define GS1_DICT_MAX_COMPONENTS 5
+
+
+/**
+ * @brief Maximum number of linters applied to a single component.
+ *
+ */
+#define GS1_DICT_MAX_LINTERS 4
+
+
+/**
+ * @brief Maximum length of a single component.
+ *
+ */
+#define GS1_DICT_MAX_COMPONENT_LEN 99
+
+
+/**
+ * @brief Flags for a Syntax Dictionary entry.
+ *
+ */
+#define GS1_DICT_FLAG_NO_FNC1		0x01	///< "*" - Pre-defined length AI not requiring FNC1 separator.
+#define GS1_DICT_FLAG_DL_DATA_ATTR	0x02	///< "?" - AI permitted as a GS1 Digital Link data attribute.
+
+
+/**
+ * @brief A component of the specification of a Syntax Dictionary entry.
+ *
+ */
+typedef struct {
+	char cset;						///< Character set: "N", "X", "Y" or "Z".
+	bool optional;						///< Component was given in "[...]".
+	unsigned char min;					///< Minimum length.
+	unsigned char max;					///< Maximum length.
+	unsigned char num_linters;				///< Number of entries in `linters`.
+	gs1_linter_t linters[GS1_DICT_MAX_LINTERS];		///< Linters applied to the component, in order.
+} gs1_dict_component_t;
+
+
+/**
+ * @brief A Syntax Dictionary entry for a single AI.
+ *
+ * Entries given as a range of AIs in the Syntax Dictionary are expanded into
+ * an entry for each AI that share the specification, attributes and title.
+ *
+ */
+typedef struct {
+	char ai[5];						///< The AI, NUL terminated.
+	unsigned char flags;					///< Combination of `GS1_DICT_FLAG_*` values.
+	unsigned char num_components;				///< Number of entries in `components`.
+	const gs1_dict_component_t *components;			///< The components of the specification.
+	const char *attrs;					///< The attributes as given, e.g. "req=01,02 ex=310n"; empty if none.
+	const char *title;					///< The title; empty if none.
+} gs1_dict_entry_t;
+
+
+/**
+ * @brief A loaded Syntax Dictionary. The contents are private.
+ *
+ */
+typedef struct gs1_dict_s gs1_dict_t;
+
+
+/**
+ * @brief A store holding one or more releases of the Syntax Dictionary with
+ * shared storage for their common data. The contents are private.
+ *
+ */
+typedef struct gs1_dict_store_s gs1_dict_store_t;
+
+
+/**
+ * @brief State held by a reader of shared, runtime-replaceable data between
+ * entering and exiting a read-side section, e.g. gs1_dict_enter(). The
+ * contents are private.
+ *
+ */
+typedef struct {
+	long epoch;						///< Private.
+	unsigned int stripe;					///< Private.
+} gs1_lint_epoch_guard_t;
+
+
+/**
+ * @brief Statistics for a linter, as reported by gs1_linter_stats_snapshot().
+ *
+ */
+typedef struct {
+	const char *name;					///< The linter name, e.g. "csum".
+	uint64_t calls;						///< Number of calls.
+	uint64_t bytes;						///< Total length of the data over all calls.
+	uint64_t returns[__GS1_LINTER_NUM_ERRS];		///< Number of calls returning each ::gs1_lint_err_t, including #GS1_LINTER_OK.
+} gs1_linter_stats_t;
+
+
+/**
+ * @brief A date decoded by gs1_parse_yyyymmdd(), gs1_parse_yymmdd() and
+ * similar.
+ *
+ */
+typedef struct {
+	uint16_t year;						///< Year, 0 - 9999.
+	uint8_t month;						///< Month, 1 - 12.
+	uint8_t day;						///< Day of the month, 1 - 31, or 0 if the date is given to month precision.
+	int32_t epoch_day;					///< Days since 1970-01-01. When `day` is 0 this is the last day of the month.
+} gs1_parse_date_t;
+
+
+/**
+ * @brief A time of day decoded by gs1_parse_hhmi().
+ *
+ */
+typedef struct {
+	uint8_t hour;						///< Hour, 0 - 23.
+	uint8_t minute;						///< Minute, 0 - 59.
+	uint16_t minutes;					///< Minutes since midnight, 0 - 1439.
+} gs1_parse_time_t;
+
+
+/**
+ * @brief A WGS84 coordinate component decoded by gs1_parse_latitude() or
+ * gs1_parse_longitude().
+ *
+ */
+typedef struct {
+	int32_t e7;						///< Signed degrees in units of 10^-7, i.e. the number of degrees multiplied by 10000000.
+} gs1_parse_coord_t;
+
+
+/**
+ * @brief A count decoded by gs1_parse_pieceoftotal() or
+ * gs1_parse_posinseqslash().
+ *
+ */
+typedef struct {
+	uint64_t piece;						///< Piece number or position, saturating at UINT64_MAX.
+	uint64_t total;						///< Total number of pieces or end position, saturating at UINT64_MAX.
+} gs1_parse_piece_t;
+
+
+/**
+ * @brief The location of a field within the data given to a gs1_parse_*()
+ * function.
+ *
+ */
+typedef struct {
+	uint16_t pos;						///< Offset of the field within the data.
+	uint16_t len;						///< Length of the field, or 0 if the field is absent.
+} gs1_parse_span_t;
+
+
+/**
+ * @brief A purchase requirement of a coupon decoded by gs1_parse_couponcode().
+ *
+ */
+typedef struct {
+	uint32_t requirement;					///< Purchase Requirement.
+	uint8_t code;						///< Purchase Requirement Code.
+	uint16_t family_code;					///< Purchase Family Code.
+	gs1_parse_span_t gcp;					///< Purchase GCP, or absent if it is the primary GCP.
+} gs1_parse_coupon_purchase_t;
+
+
+/**
+ * @brief A North American Coupon Code, as carried in AI (8110), decoded by
+ * gs1_parse_couponcode().
+ *
+ * Members for optional fields that are not present are zero.
+ *
+ */
+typedef struct {
+	uint16_t fields;					///< Bit `n` is set if optional field `n` is present.
+	gs1_parse_span_t gcp;					///< Primary GCP.
+	uint32_t offer_code;					///< Offer Code.
+	uint32_t save_value;					///< Save Value.
+	gs1_parse_coupon_purchase_t purchase[3];		///< 1st, 2nd (optional field 1) and 3rd (optional field 2) purchase requirements.
+	uint8_t additional_purchase_rules_code;			///< Additional Purchase Rules Code (optional field 1).
+	gs1_parse_date_t expiration_date;			///< Expiration Date (optional field 3).
+	gs1_parse_date_t start_date;				///< Start Date (optional field 4).
+	gs1_parse_span_t serial_number;				///< Serial Number (optional field 5).
+	gs1_parse_span_t retailer;				///< Retailer GCP/GLN (optional field 6).
+	uint8_t save_value_code;				///< Save Value Code (optional field 9).
+	uint8_t save_value_applies_to_item;			///< Save Value Applies to Item (optional field 9).
+	uint8_t store_coupon_flag;				///< Store Coupon Flag (optional field 9).
+	uint8_t dont_multiply_flag;				///< Don't Multiply Flag (optional field 9).
+} gs1_parse_coupon_t;
+
+
+/**
+ * @brief A positive offer file coupon, as carried in AI (8112), decoded by
+ * gs1_parse_couponposoffer().
+ *
+ */
+typedef struct {
+	uint8_t format_code;					///< Coupon Format.
+	gs1_parse_span_t funder;				///< Coupon Funder ID.
+	uint32_t offer_code;					///< Offer Code.
+	gs1_parse_span_t serial_number;				///< Serial Number.
+} gs1_parse_posoffer_t;
+
+
+/**
+ * @brief A problem with some data, as recorded by gs1_lint_collect().
+ *
+ */
+typedef struct {
+	gs1_lint_err_t err;					///< The error reported by the linter.
+	size_t err_pos;						///< Start of the bad data.
+	size_t err_len;						///< Length of the bad data.
+} gs1_lint_finding_t;
+
+
+/**
+ * @brief A bump allocator over memory provided by the caller. Everything
+ * allocated from an arena is released at once by gs1_arena_reset(). An arena
+ * is not thread safe.
+ *
+ */
+typedef struct {
+	unsigned char *base;					///< The memory.
+	size_t size;						///< Size of the memory.
+	size_t used;						///< Number of bytes allocated, including alignment padding.
+} gs1_arena_t;
+
+
+/**
+ * @brief Maximum number of AIs recorded in a gs1_message_t.
+ *
+ */
+#define GS1_MESSAGE_MAX_AIS 64
+
+
+/**
+ * @brief Outcome of scanning an element string into a gs1_message_t.
+ *
+ */
+typedef enum {
+	GS1_MESSAGE_OK = 0,				///< The element string is valid.
+	GS1_MESSAGE_UNKNOWN_AI,				///< No entry in the dictionary for the AI.
+	GS1_MESSAGE_TRUNCATED_VALUE,			///< The data ends within the value of an AI with predefined length.
+	GS1_MESSAGE_INVALID_COMPONENT_LENGTH,		///< A component is shorter or longer than permitted.
+	GS1_MESSAGE_LINT_FAILED,			///< A component failed its character set or a linter; see `lint_err`.
+	GS1_MESSAGE_TOO_MANY_AIS,			///< The element string has more than #GS1_MESSAGE_MAX_AIS AIs.
+	GS1_MESSAGE_TOO_LONG,				///< The element string is longer than 65535 characters.
+	GS1_MESSAGE_NOT_ELEMENT_STRING,			///< The scanned data is not an element string; see gs1_input_identify().
+} gs1_message_err_t;
+
+
+/**
+ * @brief An element string split into its AIs and their components, held as
+ * parallel arrays of offsets into the caller's buffer.
+ *
+ * AI `i` is `ai[i]`, with value `value_pos[i]`, `value_len[i]`. Its components
+ * are `component_pos[j]`, `component_len[j]` for `j` from
+ * `component_first[i]` up to, but excluding, `component_first[i + 1]`,
+ * omitting any trailing optional components that are absent.
+ *
+ * No memory is allocated, so the same message may be reused for each scan.
+ *
+ */
+typedef struct {
+	uint16_t num_ais;						///< Number of AIs recorded.
+	uint16_t num_components;					///< Number of components recorded.
+	gs1_message_err_t err;						///< Outcome of the scan.
+	gs1_lint_err_t lint_err;					///< Error from the linter, if `err` is #GS1_MESSAGE_LINT_FAILED.
+	uint16_t err_pos;						///< Start of the bad data within the element string.
+	uint16_t err_len;						///< Length of the bad data.
+	const gs1_dict_entry_t *ai[GS1_MESSAGE_MAX_AIS];		///< Dictionary entry for each AI.
+	uint16_t value_pos[GS1_MESSAGE_MAX_AIS];			///< Start of each AI value.
+	uint16_t value_len[GS1_MESSAGE_MAX_AIS];			///< Length of each AI value.
+	uint16_t component_first[GS1_MESSAGE_MAX_AIS + 1];		///< Index of the first component of each AI.
+	uint16_t component_pos[GS1_MESSAGE_MAX_AIS * GS1_DICT_MAX_COMPONENTS];	///< Start of each component.
+	uint16_t component_len[GS1_MESSAGE_MAX_AIS * GS1_DICT_MAX_COMPONENTS];	///< Length of each component.
+} gs1_message_t;
+
+
+/**
+ * @brief The state of the validation of an element string that is provided
+ * one character at a time, e.g. by a keyboard wedge scanner, by
+ * gs1_message_stream_feed().
+ *
+ * Only the current component is held, together with a running sum of its
+ * digits for a check digit and the layout of its date or time fields, so each
+ * character is validated in constant time until the component is complete,
+ * and an error is reported by the character at which it becomes certain.
+ *
+ */
+typedef struct {
+	const gs1_dict_t *dict;						///< The Syntax Dictionary.
+	char fnc1;							///< The character representing FNC1.
+	gs1_message_err_t err;						///< Outcome so far.
+	gs1_lint_err_t lint_err;					///< Error from the linter, if `err` is #GS1_MESSAGE_LINT_FAILED.
+	uint16_t err_pos;						///< Start of the bad data within the element string.
+	uint16_t err_len;						///< Length of the bad data, so far as it is known.
+	uint16_t pos;							///< Number of characters provided.
+	uint16_t num_ais;						///< Number of AIs completed.
+	const gs1_dict_entry_t *entry;					///< Dictionary entry for the current AI, or `NULL` between AIs.
+	char ai[4];							///< The characters of the AI being read, while `entry` is `NULL`.
+	uint8_t ai_len;							///< Number of characters in `ai`.
+	bool skip_fnc1;							///< An FNC1 following an AI with predefined length is ignored.
+	uint16_t value_pos;						///< Start of the value of the current AI.
+	uint8_t component;						///< Index of the current component.
+	uint8_t len;							///< Number of characters in the current component.
+	uint8_t pads;							///< Number of "=" ending the current component, which may yet be CSET 64 padding.
+	uint16_t component_pos;						///< Start of the current component.
+	uint16_t sum[2];						///< Sum of the digits of the current component at even and odd positions.
+	const char *fields;						///< Date or time field of each character of the current component, e.g. "YYMMDD", or `NULL`.
+	char data[GS1_DICT_MAX_COMPONENT_LEN];				///< The characters of the current component.
+} gs1_message_stream_t;
+
+
+/**
+ * @brief FNC1 as transmitted by a scanner within an element string: ASCII
+ * GS (Group Separator).
+ *
+ */
+#define GS1_INPUT_FNC1 '\x1D'
+
+
+/**
+ * @brief The kind of data received from a scanner.
+ *
+ */
+typedef enum {
+	GS1_INPUT_UNRECOGNISED = 0,			///< Not recognised as GS1 data.
+	GS1_INPUT_ELEMENT_STRING,			///< An element string, with FNC1 transmitted as #GS1_INPUT_FNC1.
+	GS1_INPUT_DIGITAL_LINK,				///< A GS1 Digital Link URI.
+} gs1_input_kind_t;
+
+
+/**
+ * @brief Data received from a scanner, as identified by gs1_input_identify().
+ *
+ * The payload is the data following any symbology identifier, and is not
+ * copied.
+ *
+ */
+typedef struct {
+	gs1_input_kind_t kind;						///< The kind of data.
+	char symbology;							///< Symbology character of the AIM symbology identifier, e.g. 'C', or 0 if there is none.
+	char modifier;							///< Modifier character of the AIM symbology identifier, e.g. '1', or 0 if there is none.
+	size_t payload_pos;						///< Start of the payload.
+} gs1_input_t;
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -272,8 +686,72 @@ GS1_SYNTAX_DICTIONARY_API DEPRECATED gs1_lint_err_t gs1_lint_keyoff1(const char
 GS1_SYNTAX_DICTIONARY_API DEPRECATED gs1_lint_err_t gs1_lint_mmoptss(const char *data, size_t data_len, size_t *err_pos, size_t *err_len);
 GS1_SYNTAX_DICTIONARY_API DEPRECATED gs1_lint_err_t gs1_lint_yymmddhh(const char *data, size_t data_len, size_t *err_pos, size_t *err_len);
 
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_couponcode(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_coupon_t *coupon);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_couponposoffer(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_posoffer_t *posoffer);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_hhmi(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_time_t *hhmi);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_latitude(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_coord_t *coord);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_longitude(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_coord_t *coord);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_pieceoftotal(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_piece_t *piece);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_posinseqslash(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_piece_t *piece);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yymmd0(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_date_t *date);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yymmdd(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_date_t *date);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yyyymmd0(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_date_t *date);
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yyyymmdd(const char *data, size_t data_len, size_t *err_pos, size_t *err_len, gs1_parse_date_t *date);
+
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_cset39_valid(const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_cset64_valid(const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_cset82_valid(const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_csetnumeric_valid(const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_valid(gs1_linter_t linter, const char *data, size_t data_len);
+
 GS1_SYNTAX_DICTIONARY_API gs1_linter_t gs1_linter_from_name(const char *name);
 
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_codelist_load(gs1_lint_codelist_t list, const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_codelist_load_file(gs1_lint_codelist_t list, const char *path);
+GS1_SYNTAX_DICTIONARY_API void gs1_lint_codelist_reset(gs1_lint_codelist_t list);
+
+GS1_SYNTAX_DICTIONARY_API void gs1_lint_revalidate_init(gs1_lint_revalidate_queue_t *queue, gs1_lint_revalidate_item_t *items, size_t capacity);
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_revalidate_push(gs1_lint_revalidate_queue_t *queue, gs1_linter_t linter, const char *data, size_t data_len, size_t offset, void *user);
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_revalidate_run(gs1_lint_revalidate_queue_t *queue, gs1_lint_revalidate_cb_t callback, void *ctx);
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_revalidate_pending(const gs1_lint_revalidate_queue_t *queue);
+
+GS1_SYNTAX_DICTIONARY_API void gs1_arena_init(gs1_arena_t *arena, void *mem, size_t size);
+GS1_SYNTAX_DICTIONARY_API void* gs1_arena_alloc(gs1_arena_t *arena, size_t size);
+GS1_SYNTAX_DICTIONARY_API void gs1_arena_reset(gs1_arena_t *arena);
+
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_collect(const gs1_linter_t *linters, size_t num_linters, const char *data, size_t data_len, gs1_lint_finding_t *findings, size_t capacity);
+GS1_SYNTAX_DICTIONARY_API size_t gs1_lint_bulk(gs1_linter_t linter, const char *data, const uint32_t *offsets, size_t count, gs1_lint_err_t *errs, uint32_t *err_pos, uint32_t *err_len);
+
+GS1_SYNTAX_DICTIONARY_API gs1_dict_t* gs1_dict_load(const char *data, size_t data_len, size_t *err_line);
+GS1_SYNTAX_DICTIONARY_API gs1_dict_t* gs1_dict_load_file(const char *path, size_t *err_line);
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_free(gs1_dict_t *dict);
+GS1_SYNTAX_DICTIONARY_API const char* gs1_dict_release(const gs1_dict_t *dict);
+GS1_SYNTAX_DICTIONARY_API size_t gs1_dict_num_entries(const gs1_dict_t *dict);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_entry_t* gs1_dict_entry_at(const gs1_dict_t *dict, size_t idx);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_entry_t* gs1_dict_lookup(const gs1_dict_t *dict, const char *ai, size_t ai_len);
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_install(gs1_dict_t *dict);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_enter(gs1_lint_epoch_guard_t *guard);
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_exit(const gs1_lint_epoch_guard_t *guard);
+GS1_SYNTAX_DICTIONARY_API gs1_dict_store_t* gs1_dict_store_new(void);
+GS1_SYNTAX_DICTIONARY_API gs1_dict_store_t* gs1_dict_store_new_arena(gs1_arena_t *arena);
+GS1_SYNTAX_DICTIONARY_API void gs1_dict_store_free(gs1_dict_store_t *store);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_load(gs1_dict_store_t *store, const char *data, size_t data_len, size_t *err_line);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_load_file(gs1_dict_store_t *store, const char *path, size_t *err_line);
+GS1_SYNTAX_DICTIONARY_API const gs1_dict_t* gs1_dict_store_find(const gs1_dict_store_t *store, const char *release);
+GS1_SYNTAX_DICTIONARY_API size_t gs1_dict_store_size(const gs1_dict_store_t *store);
+
+GS1_SYNTAX_DICTIONARY_API void gs1_message_reset(gs1_message_t *msg);
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan(gs1_message_t *msg, const gs1_dict_t *dict, const char *data, size_t data_len, char fnc1);
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan_select(gs1_message_t *msg, const gs1_dict_t *dict, const char *data, size_t data_len, char fnc1, const gs1_dict_entry_t* const *select, size_t num_select);
+GS1_SYNTAX_DICTIONARY_API void gs1_message_stream_init(gs1_message_stream_t *stream, const gs1_dict_t *dict, char fnc1);
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_stream_feed(gs1_message_stream_t *stream, char c);
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_stream_finish(gs1_message_stream_t *stream);
+GS1_SYNTAX_DICTIONARY_API gs1_input_kind_t gs1_input_identify(gs1_input_t *input, const char *data, size_t data_len);
+GS1_SYNTAX_DICTIONARY_API gs1_message_err_t gs1_message_scan_input(gs1_message_t *msg, const gs1_dict_t *dict, const char *data, size_t data_len, gs1_input_t *input);
+
+GS1_SYNTAX_DICTIONARY_API size_t gs1_linter_stats_snapshot(gs1_linter_stats_t *stats, size_t max);
+GS1_SYNTAX_DICTIONARY_API void gs1_linter_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
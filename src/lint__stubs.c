@@ -40,6 +40,7 @@ GS1_SYNTAX_DICTIONARY_API DEPRECATED gs1_lint_err_t linter(	\
 	(void)data_len;						\
 	(void)err_pos;						\
 	(void)err_len;						\
+	GS1_LINTER_PROBE_ENTRY();				\
 	GS1_LINTER_RETURN_OK;					\
 }
 
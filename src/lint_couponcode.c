@@ -31,6 +31,7 @@
 
 
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -38,6 +39,178 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
+/*
+ *  Schema for the fields of a NACC, recorded into a gs1_parse_coupon_t.
+ *
+ *  Linter 1 is "gcppos1" and linter 2 is "yymmdd".
+ *
+ */
+/// \cond
+#define COUPON_DEST(field) (uint16_t)offsetof(gs1_parse_coupon_t, field)
+#define COUPON_OPTIONAL(n, steps) {						\
+	.op = GS1_LINTER_VLI_OPTIONAL, .len = n, .skip = steps,			\
+	.store = GS1_LINTER_VLI_STORE_FIELD, .dest = COUPON_DEST(fields)	\
+}
+#define COUPON_DIGIT(lo, hi, extra, field, err_missing, err_invalid) {		\
+	.op = GS1_LINTER_VLI_DIGIT,						\
+	.digits = GS1_LINTER_VLI_DIGITS(lo, hi) | (extra),			\
+	.store = GS1_LINTER_VLI_STORE_U8, .dest = COUPON_DEST(field),		\
+	.missing = GS1_LINTER_COUPON_MISSING_##err_missing,			\
+	.invalid = GS1_LINTER_COUPON_INVALID_##err_invalid			\
+}
+#define COUPON_FIXED(length, kind, field, err_truncated) {			\
+	.op = GS1_LINTER_VLI_FIXED, .len = length,				\
+	.store = GS1_LINTER_VLI_STORE_##kind, .dest = COUPON_DEST(field),	\
+	.truncated = GS1_LINTER_COUPON_TRUNCATED_##err_truncated		\
+}
+#define COUPON_VAR(lo, hi, plus, linter, flag, kind, field, err_missing, err_invalid, err_truncated) {	\
+	.op = GS1_LINTER_VLI_VAR, .len = plus, .lint = linter, .flags = flag,	\
+	.digits = GS1_LINTER_VLI_DIGITS(lo, hi) | ((flag) ? 1U << 9 : 0),	\
+	.store = GS1_LINTER_VLI_STORE_##kind, .dest = COUPON_DEST(field),	\
+	.missing = GS1_LINTER_COUPON_MISSING_##err_missing,			\
+	.invalid = GS1_LINTER_COUPON_INVALID_##err_invalid,			\
+	.truncated = GS1_LINTER_COUPON_TRUNCATED_##err_truncated		\
+}
+#define COUPON_DATE(flag, field, err_too_short, err_invalid) {			\
+	.op = GS1_LINTER_VLI_DATE, .lint = 2, .flags = flag,			\
+	.store = GS1_LINTER_VLI_STORE_DATE, .dest = COUPON_DEST(field),		\
+	.invalid = GS1_LINTER_COUPON_INVALID_##err_invalid,			\
+	.truncated = GS1_LINTER_COUPON_TOO_SHORT_FOR_##err_too_short,		\
+	.order = GS1_LINTER_COUPON_EXPIRATION_BEFORE_START			\
+}
+/// \endcond
+
+static const gs1_lint_vli_step_t couponcode_schema[] = {
+
+	/*
+	 * Primary GCP with VLI "0" to "6" giving its length (plus 6), offer
+	 * code, Save Value with VLI "1" to "5", and the 1st purchase
+	 * requirement with VLI "1" to "5", code "0" to "4" or "9" and family
+	 * code.
+	 *
+	 */
+	COUPON_VAR(0, 6, 6, 1, 0, SPAN, gcp, GCP_VLI, GCP_LENGTH, GCP),
+	COUPON_FIXED(6, U32, offer_code, OFFER_CODE),
+	COUPON_VAR(1, 5, 0, 0, 0, U32, save_value, SAVE_VALUE_VLI, SAVE_VALUE_LENGTH, SAVE_VALUE),
+	COUPON_VAR(1, 5, 0, 0, 0, U32, purchase[0].requirement, 1ST_PURCHASE_REQUIREMENT_VLI, 1ST_PURCHASE_REQUIREMENT_LENGTH, 1ST_PURCHASE_REQUIREMENT),
+	COUPON_DIGIT(0, 4, 1U << 9, purchase[0].code, 1ST_PURCHASE_REQUIREMENT_CODE, 1ST_PURCHASE_REQUIREMENT_CODE),
+	COUPON_FIXED(3, U16, purchase[0].family_code, 1ST_PURCHASE_FAMILY_CODE),
+
+	/*
+	 * Optional field 1: Additional rules code "0" to "3" and 2nd purchase,
+	 * whose GCP VLI of "9" indicates that there is no GCP.
+	 *
+	 */
+	COUPON_OPTIONAL(1, 5),
+	COUPON_DIGIT(0, 3, 0, additional_purchase_rules_code, ADDITIONAL_PURCHASE_RULES_CODE, ADDITIONAL_PURCHASE_RULES_CODE),
+	COUPON_VAR(1, 5, 0, 0, 0, U32, purchase[1].requirement, 2ND_PURCHASE_REQUIREMENT_VLI, 2ND_PURCHASE_REQUIREMENT_LENGTH, 2ND_PURCHASE_REQUIREMENT),
+	COUPON_DIGIT(0, 4, 1U << 9, purchase[1].code, 2ND_PURCHASE_REQUIREMENT_CODE, 2ND_PURCHASE_REQUIREMENT_CODE),
+	COUPON_FIXED(3, U16, purchase[1].family_code, 2ND_PURCHASE_FAMILY_CODE),
+	COUPON_VAR(0, 6, 6, 1, GS1_LINTER_VLI_NINE_EMPTY, SPAN, purchase[1].gcp, 2ND_PURCHASE_GCP_VLI, 2ND_PURCHASE_GCP_LENGTH, 2ND_PURCHASE_GCP),
+
+	/*
+	 * Optional field 2: 3rd purchase.
+	 *
+	 */
+	COUPON_OPTIONAL(2, 4),
+	COUPON_VAR(1, 5, 0, 0, 0, U32, purchase[2].requirement, 3RD_PURCHASE_REQUIREMENT_VLI, 3RD_PURCHASE_REQUIREMENT_LENGTH, 3RD_PURCHASE_REQUIREMENT),
+	COUPON_DIGIT(0, 4, 1U << 9, purchase[2].code, 3RD_PURCHASE_REQUIREMENT_CODE, 3RD_PURCHASE_REQUIREMENT_CODE),
+	COUPON_FIXED(3, U16, purchase[2].family_code, 3RD_PURCHASE_FAMILY_CODE),
+	COUPON_VAR(0, 6, 6, 1, GS1_LINTER_VLI_NINE_EMPTY, SPAN, purchase[2].gcp, 3RD_PURCHASE_GCP_VLI, 3RD_PURCHASE_GCP_LENGTH, 3RD_PURCHASE_GCP),
+
+	/*
+	 * Optional fields 3 and 4: Expiration date and start date, the latter
+	 * of which must not follow the former.
+	 *
+	 */
+	COUPON_OPTIONAL(3, 1),
+	COUPON_DATE(0, expiration_date, EXPIRATION_DATE, EXIPIRATION_DATE),
+	COUPON_OPTIONAL(4, 1),
+	COUPON_DATE(GS1_LINTER_VLI_NOT_BEFORE, start_date, START_DATE, START_DATE),
+
+	/*
+	 * Optional field 5: Serial number with any VLI giving its length
+	 * (plus 6).
+	 *
+	 */
+	COUPON_OPTIONAL(5, 1),
+	{
+		.op = GS1_LINTER_VLI_VAR, .len = 6, .digits = GS1_LINTER_VLI_DIGITS(0, 9),
+		.store = GS1_LINTER_VLI_STORE_SPAN, .dest = COUPON_DEST(serial_number),
+		.missing = GS1_LINTER_COUPON_MISSING_SERIAL_NUMBER_VLI,
+		.truncated = GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER
+	},
+
+	/*
+	 * Optional field 6: Retailer GCP/GLN with VLI "1" to "7" giving its
+	 * length (plus 6).
+	 *
+	 */
+	COUPON_OPTIONAL(6, 1),
+	COUPON_VAR(1, 7, 6, 1, 0, SPAN, retailer, RETAILER_GCP_OR_GLN_VLI, RETAILER_GCP_OR_GLN_LENGTH, RETAILER_GCP_OR_GLN),
+
+	/*
+	 * Optional field 9: Save Value Code "0" to "2", "5" or "6", Save Value
+	 * Applies to Item "0" to "2", Store Coupon Flag, and Don't Multiply
+	 * Flag "0" or "1".
+	 *
+	 */
+	COUPON_OPTIONAL(9, 4),
+	COUPON_DIGIT(0, 2, GS1_LINTER_VLI_DIGITS(5, 6), save_value_code, SAVE_VALUE_CODE, SAVE_VALUE_CODE),
+	COUPON_DIGIT(0, 2, 0, save_value_applies_to_item, SAVE_VALUE_APPLIES_TO_ITEM, SAVE_VALUE_APPLIES_TO_ITEM),
+	{
+		.op = GS1_LINTER_VLI_DIGIT, .digits = GS1_LINTER_VLI_DIGITS(0, 9),
+		.store = GS1_LINTER_VLI_STORE_U8, .dest = COUPON_DEST(store_coupon_flag),
+		.missing = GS1_LINTER_COUPON_MISSING_STORE_COUPON_FLAG
+	},
+	COUPON_DIGIT(0, 1, 0, dont_multiply_flag, DONT_MULTIPLY_FLAG, DONT_MULTIPLY_FLAG)
+
+};
+
+#undef COUPON_DEST
+#undef COUPON_OPTIONAL
+#undef COUPON_DIGIT
+#undef COUPON_FIXED
+#undef COUPON_VAR
+#undef COUPON_DATE
+
+
+/*
+ *  Walk the fields of a NACC, recording each into `coupon` if it is not NULL.
+ *  This is shared by the linter and by gs1_parse_couponcode() so that both
+ *  validate the data in the same way and in a single pass.
+ *
+ *  Returns as for the linter, but without updating the linter statistics.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t couponcode_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_coupon_t* const coupon)
+{
+
+	const gs1_linter_t linters[] = { gs1_lint_gcppos1, gs1_lint_yymmdd };
+	size_t pos;
+
+	assert(data);
+
+	/*
+	 * Data must consist of all digits.
+	 *
+	 */
+	for (pos = 0; pos < data_len; pos++) {
+		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9')) {
+			if (err_pos) *err_pos = pos;
+			if (err_len) *err_len = 1;
+			return GS1_LINTER_NON_DIGIT_CHARACTER;
+		}
+	}
+
+	if (coupon)
+		memset(coupon, 0, sizeof(*coupon));
+
+	return gs1_lint_vli_run(couponcode_schema, sizeof(couponcode_schema) / sizeof(couponcode_schema[0]), linters, data, data_len, err_pos, err_len, coupon);
+
+}
+
+
 /**
  * Used to ensure that an AI component conforms to the North American Coupon
  * Code (NACC) specification, as carried in AI (8110).
@@ -185,768 +358,58 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_couponcode(const char* const d
 {
 
 	gs1_lint_err_t ret;
-	size_t pos;
-	int vli;
-	const char *p, *q;
-	const char *expiry_date_p = NULL;
-	int expiry_set = 0;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
-	/*
-	 * Data must consist of all digits.
-	 *
-	 */
-	for (pos = 0; pos < data_len; pos++) {
-		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_NON_DIGIT_CHARACTER,
-				pos,
-				1
-			);
-	}
-
-	p = data;
-	q = data + data_len;
-
-	/*
-	 * Validate that the GCP follows its VLI and has the corresponding
-	 * length (plus 6).
-	 *
-	 * Valid GCP VLIs are "0" to "6".
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_GCP_VLI,
-			0,
-			(size_t)(q - data)
-		);
-	if (GS1_LINTER_UNLIKELY(*p > '6'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_GCP_LENGTH,
-			(size_t)(p - data),
-			1
-		);
-	vli = *p - '0' + 6;
-
-	if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_GCP,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	/*
-	 * Validate the GCP with the "gcppos1" linter.
-	 *
-	 */
-	ret = gs1_lint_gcppos1(p, (size_t)vli, err_pos, err_len);
-
-	assert (ret == GS1_LINTER_OK ||
-		ret == GS1_LINTER_INVALID_GCP_PREFIX ||
-		ret == GS1_LINTER_GCP_DATASOURCE_OFFLINE);
-
+	ret = couponcode_decode(data, data_len, err_pos, err_len, NULL);
 	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-		GS1_LINTER_RETURN_ERROR(
-			ret,
-			(size_t)(p - data),
-			(size_t)vli
-		);
-
-	p += vli;
-
-
-	/*
-	 * Validate the existence of the six digit Offer Code.
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(q - p < 6))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_OFFER_CODE,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	p += 6;
-
-
-	/*
-	 * Validate that the Save Value follows its VLI and has the
-	 * corresponding length.
-	 *
-	 * Valid Save Value VLIs are "1" to "5".
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_SAVE_VALUE_VLI,
-			0,
-			(size_t)(q - data)
-		);
-	if (GS1_LINTER_UNLIKELY(*p < '1' || *p > '5'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_SAVE_VALUE_LENGTH,
-			(size_t)(p - data),
-			1
-		);
-	vli = *p - '0';
-
-	if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_SAVE_VALUE,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	p += vli;
-
-
-	/*
-	 * Validate 1st Purchase Requirement follows its VLI and has the
-	 * corresponding length.
-	 *
-	 * Valid 1st Purchase Requirement VLIs are "1" to "5".
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_1ST_PURCHASE_REQUIREMENT_VLI,
-			0,
-			(size_t)(q - data)
-		);
-	if (GS1_LINTER_UNLIKELY(*p < '1' || *p > '5'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_1ST_PURCHASE_REQUIREMENT_LENGTH,
-			(size_t)(p - data),
-			1
-		);
-	vli = *p - '0';
-
-	if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_1ST_PURCHASE_REQUIREMENT,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	p += vli;
-
-
-	/*
-	 * Validate the single-digit 1st Purchase Requirement Code.
-	 *
-	 * Valid values for 1st Purchase Requirement Code are "0" to "4" and
-	 * "9".
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_1ST_PURCHASE_REQUIREMENT_CODE,
-			0,
-			(size_t)(q - data)
-		);
-
-	if (GS1_LINTER_UNLIKELY(*p > '4' && *p != '9'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_1ST_PURCHASE_REQUIREMENT_CODE,
-			(size_t)(p - data),
-			1
-		);
-
-
-	/*
-	 * Validate the existence of the three-digit 1st Purchase Family Code.
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(q - ++p < 3))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_1ST_PURCHASE_FAMILY_CODE,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	p += 3;
-
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
 
-	/*
-	 * Optional field 1: Additional rules and 2nd purchase
-	 * ===================================================
-	 *
-	 * This option field is indicated by the value "1".
-	 *
-	 */
-	if (p < q && *p == '1') {
-
-		/*
-		 * Validate the single-digit Additional Purchase Rules Code.
-		 *
-		 * Valid values for the  Additional Purchase Rules Code are "0"
-		 * to "3".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_ADDITIONAL_PURCHASE_RULES_CODE,
-				0,
-				(size_t)(q - data)
-			);
-
-		if (GS1_LINTER_UNLIKELY(*p > '3'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_ADDITIONAL_PURCHASE_RULES_CODE,
-				(size_t)(p - data),
-				1
-			);
-
-
-		/*
-		 * Validate 2nd Purchase Requirement follows its VLI and has
-		 * the corresponding length.
-		 *
-		 * Valid values for the 2nd Purchase Requirement VLI are "1" to
-		 * "5".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_REQUIREMENT_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p < '1' || *p > '5'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_REQUIREMENT_LENGTH,
-				(size_t)(p - data),
-				1
-			);
-		vli = *p - '0';
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_REQUIREMENT,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		p += vli;
-
-
-		/*
-		 * Validate the single-digit 2nd Purchase Requirement Code.
-		 *
-		 * Valid values for the 2nd Purchase Requirement Code are "0"
-		 * to "4" and "9".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_REQUIREMENT_CODE,
-				0,
-				(size_t)(q - data)
-			);
-
-		if (GS1_LINTER_UNLIKELY(*p > '4' && *p != '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_REQUIREMENT_CODE,
-				(size_t)(p - data),
-				1
-			);
-
-
-		/*
-		 * Validate the existence of the three-digit 2nd Purchase
-		 * Family Code.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(q - ++p < 3))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_FAMILY_CODE,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		p += 3;
-
-
-		/*
-		 * Validate that the 2nd Purchase GCP follows its VLI and has
-		 * the corresponding length (plus 6, unless VLI is "9").
-		 *
-		 * Valid values for the 2nd Purchase GCP VLI are "0" to "6" and
-		 * "9".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_2ND_PURCHASE_GCP_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p > '6' && *p != '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_2ND_PURCHASE_GCP_LENGTH,
-				(size_t)(p - data),
-				1
-			);
-		vli = (*p != '9') ? *p - '0' + 6 : 0;
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_2ND_PURCHASE_GCP,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		/*
-		 * Validate the GCP with the "gcppos1" linter.
-		 *
-		 */
-		if (vli > 0) {
-			ret = gs1_lint_gcppos1(p, (size_t)vli, err_pos, err_len);
-
-			assert (ret == GS1_LINTER_OK ||
-				ret == GS1_LINTER_INVALID_GCP_PREFIX ||
-				ret == GS1_LINTER_GCP_DATASOURCE_OFFLINE);
-
-			if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-				GS1_LINTER_RETURN_ERROR(
-					ret,
-					(size_t)(p - data),
-					(size_t)vli
-				);
-
-			p += vli;
-		}
-
-	}
-
-
-	/*
-	 * Optional field 2: 3rd purchase
-	 * ==============================
-	 *
-	 * This option field is indicated by the value "2".
-	 *
-	 */
-	if (p < q && *p == '2') {
-
-		/*
-		 * Validate 3rd Purchase Requirement follows its VLI and has
-		 * the corresponding length.
-		 *
-		 * Valid values for the 3rd Purchase Requirement VLI are "1" to
-		 * "5".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_REQUIREMENT_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p < '1' || *p > '5'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_REQUIREMENT_LENGTH,
-				(size_t)(p - data),
-				1
-			);
-		vli = *p - '0';
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_REQUIREMENT,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		p += vli;
-
-
-		/*
-		 * Validate the single-digit 3rd Purchase Requirement Code.
-		 *
-		 * Valid values for the 3rd Purchase Requirement Code are "0"
-		 * to "4" and "9".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_REQUIREMENT_CODE,
-				0,
-				(size_t)(q - data)
-			);
-
-		if (GS1_LINTER_UNLIKELY(*p > '4' && *p != '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_REQUIREMENT_CODE,
-				(size_t)(p - data),
-				1
-			);
-
-
-		/*
-		 * Validate that existence of the three digit 3rd Purchase
-		 * Family Code.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(q - ++p < 3))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_FAMILY_CODE,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		p += 3;
-
-
-		/*
-		 * Validate that the 3rd Purchase GCP follows its VLI and has
-		 * the corresponding length (plus 6, unless VLI is "9").
-		 *
-		 * Valid values for the 3rd Purchase GCP VLI are "0" to "6" and
-		 * "9".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_3RD_PURCHASE_GCP_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p > '6' && *p != '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_3RD_PURCHASE_GCP_LENGTH,
-				(size_t)(p - data),
-				1
-			);
-		vli = (*p != '9') ? *p - '0' + 6 : 0;
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_3RD_PURCHASE_GCP,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		/*
-		 * Validate the GCP with the "gcppos1" linter.
-		 *
-		 */
-		if (vli > 0) {
-			ret = gs1_lint_gcppos1(p, (size_t)vli, err_pos, err_len);
-
-			assert (ret == GS1_LINTER_OK ||
-				ret == GS1_LINTER_INVALID_GCP_PREFIX ||
-				ret == GS1_LINTER_GCP_DATASOURCE_OFFLINE);
-
-			if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-				GS1_LINTER_RETURN_ERROR(
-					ret,
-					(size_t)(p - data),
-					(size_t)vli
-				);
-
-			p += vli;
-		}
-
-	}
-
-
-	/*
-	 * Optional field 3: Expiration date
-	 * =================================
-	 *
-	 * This option field is indicated by the value "3".
-	 *
-	 */
-	if (p < q && *p == '3') {
-
-		/*
-		 * Validate that the expiration date is in YYMMDD format.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(q - ++p < 6))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TOO_SHORT_FOR_EXPIRATION_DATE,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		expiry_date_p = p;
-		ret = gs1_lint_yymmdd(p, 6, err_pos, err_len);
-
-		assert(ret == GS1_LINTER_OK ||
-		       ret == GS1_LINTER_DATE_TOO_SHORT ||
-		       ret == GS1_LINTER_DATE_TOO_LONG ||
-		       ret == GS1_LINTER_NON_DIGIT_CHARACTER ||
-		       ret == GS1_LINTER_ILLEGAL_MONTH ||
-		       ret == GS1_LINTER_ILLEGAL_DAY);
-
-		if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_EXIPIRATION_DATE,
-				(size_t)(p - data),
-				6
-			);
-
-		p += 6;
-
-		expiry_set = 1;
-
-	}
-
-
-	/*
-	 * Optional field 4: Start date
-	 * ============================
-	 *
-	 * This option field is indicated by the value "4".
-	 *
-	 */
-	if (p < q && *p == '4') {
-
-		const char *start_date_p;
-
-		/*
-		 * Validate that the start date is in YYMMDD format.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(q - ++p < 6))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TOO_SHORT_FOR_START_DATE,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		start_date_p = p;
-		ret = gs1_lint_yymmdd(p, 6, err_pos, err_len);
-
-		assert(ret == GS1_LINTER_OK ||
-		       ret == GS1_LINTER_DATE_TOO_SHORT ||
-		       ret == GS1_LINTER_DATE_TOO_LONG ||
-		       ret == GS1_LINTER_NON_DIGIT_CHARACTER ||
-		       ret == GS1_LINTER_ILLEGAL_MONTH ||
-		       ret == GS1_LINTER_ILLEGAL_DAY);
-
-		if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_START_DATE,
-				(size_t)(p - data),
-				6
-			);
-
-		/*
-		 * If an expiration date has been set, then ensure that it does
-		 * not precede the start date.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(expiry_set && memcmp(start_date_p, expiry_date_p, 6) > 0))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_EXPIRATION_BEFORE_START,
-				(size_t)(p - data - 8),
-				14
-			);
-
-		p += 6;
-
-	}
-
-
-	/*
-	 * Optional field 5: Serial number
-	 * ===============================
-	 *
-	 * This option field is indicated by the value "5".
-	 *
-	 */
-	if (p < q && *p == '5') {
-
-		/*
-		 * Validate Serial Number follows its VLI and has the corresponding
-		 * length (plus 6).
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_SERIAL_NUMBER_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		vli = *p - '0' + 6;
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		p += vli;
-
-	}
-
-
-	/*
-	 * Optional field 6: Retailer GCP/GLN
-	 * ==================================
-	 *
-	 * This option field is indicated by the value "6".
-	 *
-	 */
-	if (p < q && *p == '6') {
-
-		/*
-		 * Validate that the Retailer GCP/GLN follows its VLI and has
-		 * the corresponding length (plus 6).
-		 *
-		 * Valid values for the Retailer GCP/GLN VLI are "1" to "7".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_RETAILER_GCP_OR_GLN_VLI,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p < '1' || *p > '7'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_RETAILER_GCP_OR_GLN_LENGTH,
-				(size_t)(p - data),
-				1
-			);
-		vli = *p - '0' + 6;
-
-		if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_TRUNCATED_RETAILER_GCP_OR_GLN,
-				(p == q) ? 0                  : (size_t)(p - data),
-				(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-			);
-
-		/*
-		 * Validate the GCP/GLN with the "gcppos1" linter.
-		 *
-		 */
-		ret = gs1_lint_gcppos1(p, (size_t)vli, err_pos, err_len);
-
-		assert (ret == GS1_LINTER_OK ||
-			ret == GS1_LINTER_INVALID_GCP_PREFIX ||
-			ret == GS1_LINTER_GCP_DATASOURCE_OFFLINE);
-
-		if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-			GS1_LINTER_RETURN_ERROR(
-				ret,
-				(size_t)(p - data),
-				(size_t)vli
-			);
-
-		p += vli;
-
-	}
-
-
-	/*
-	 * Optional field 9: Miscellaneous
-	 * ===============================
-	 *
-	 * This option field is indicated by the value "9".
-	 *
-	 */
-	if (p < q && *p == '9') {
+	GS1_LINTER_RETURN_OK;
 
-		/*
-		 * Validate the single-digit Save Value Code.
-		 *
-		 * Valid values for the Save Value Code are "0" to "2" and "5"
-		 * to "6".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_SAVE_VALUE_CODE,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p != '0' && *p != '1' && *p != '2' && *p != '5' && *p != '6'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_SAVE_VALUE_CODE,
-				(size_t)(p - data),
-				1
-			);
+}
 
 
-		/*
-		 * Validate the single-digit Save Value Applies to Item value.
-		 *
-		 * Valid values for Save Value Applies to Item are "0" to "2".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_SAVE_VALUE_APPLIES_TO_ITEM,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p > '2'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_SAVE_VALUE_APPLIES_TO_ITEM,
-				(size_t)(p - data),
-				1
-			);
 
+#ifndef GS1_LINTER_NO_PARSE
 
-		/*
-		 * Validate the existence of the single-digit Store Coupon
-		 * Flag.
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_STORE_COUPON_FLAG,
-				0,
-				(size_t)(q - data)
-			);
+/**
+ * Companion to gs1_lint_couponcode() that also returns the fields of the
+ * coupon, recorded as the data is validated.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] coupon Receives the decoded fields if the data is valid,
+ *                     otherwise is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_couponcode()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_couponcode(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_coupon_t* const coupon)
+{
 
+	gs1_parse_coupon_t decoded;
+	gs1_lint_err_t ret;
 
-		/*
-		 * Validate the single-digit Don't Multiply Flag.
-		 *
-		 * Valid values for the Don't Multiply Flag are "0" and "1".
-		 *
-		 */
-		if (GS1_LINTER_UNLIKELY(++p == q))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_MISSING_DONT_MULTIPLY_FLAG,
-				0,
-				(size_t)(q - data)
-			);
-		if (GS1_LINTER_UNLIKELY(*p != '0' && *p != '1'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_COUPON_INVALID_DONT_MULTIPLY_FLAG,
-				(size_t)(p - data),
-				1
-			);
-
-		p++;
+	assert(data);
+	assert(coupon);
 
-	}
+	ret = couponcode_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
 
-	/*
-	 * Report excess data that has not been handled as an optional field.
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p != q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_EXCESS_DATA,
-			(size_t)(p - data),
-			(size_t)(q - p)
-		);
+	*coupon = decoded;
 
-	GS1_LINTER_RETURN_OK;
+	return GS1_LINTER_OK;
 
 }
 
+#endif  /* GS1_LINTER_NO_PARSE */
 
 #ifdef UNIT_TESTS
 
@@ -1461,6 +924,68 @@ void test_lint_couponcode(void)
 }
 #endif
 
+	{
+		static const char coupon_all[] =
+			"1" "0614141" "123456" "3" "150" "2" "10" "1" "001"
+			"1" "2" "1" "3" "0" "002" "9"
+			"2" "2" "25" "9" "003" "1" "0614141"
+			"3" "251231"
+			"4" "250101"
+			"5" "0" "123456"
+			"6" "1" "0614141"
+			"9" "5" "1" "0" "1";
+		gs1_parse_coupon_t coupon;
+		size_t pos, len;
+
+		TEST_CHECK(gs1_parse_couponcode(coupon_all, strlen(coupon_all), NULL, NULL, &coupon) == GS1_LINTER_OK);
+		TEST_CHECK(coupon.fields == (1U << 1 | 1U << 2 | 1U << 3 | 1U << 4 | 1U << 5 | 1U << 6 | 1U << 9));
+		TEST_CHECK(coupon.gcp.pos == 1 && coupon.gcp.len == 7);
+		TEST_CHECK(coupon.offer_code == 123456);
+		TEST_CHECK(coupon.save_value == 150);
+		TEST_CHECK(coupon.purchase[0].requirement == 10);
+		TEST_CHECK(coupon.purchase[0].code == 1);
+		TEST_CHECK(coupon.purchase[0].family_code == 1);
+		TEST_CHECK(coupon.purchase[0].gcp.len == 0);
+		TEST_CHECK(coupon.additional_purchase_rules_code == 2);
+		TEST_CHECK(coupon.purchase[1].requirement == 3);
+		TEST_CHECK(coupon.purchase[1].code == 0);
+		TEST_CHECK(coupon.purchase[1].family_code == 2);
+		TEST_CHECK(coupon.purchase[1].gcp.len == 0);
+		TEST_CHECK(coupon.purchase[2].requirement == 25);
+		TEST_CHECK(coupon.purchase[2].code == 9);
+		TEST_CHECK(coupon.purchase[2].family_code == 3);
+		TEST_CHECK(coupon.purchase[2].gcp.pos == 43 && coupon.purchase[2].gcp.len == 7);
+		TEST_CHECK(coupon.expiration_date.year == 2025 && coupon.expiration_date.month == 12 && coupon.expiration_date.day == 31);
+		TEST_CHECK(coupon.expiration_date.epoch_day == 20453);
+		TEST_CHECK(coupon.start_date.epoch_day == 20089);
+		TEST_CHECK(coupon.serial_number.pos == 66 && coupon.serial_number.len == 6);
+		TEST_CHECK(coupon.retailer.pos == 74 && coupon.retailer.len == 7);
+		TEST_CHECK(coupon.save_value_code == 5);
+		TEST_CHECK(coupon.save_value_applies_to_item == 1);
+		TEST_CHECK(coupon.store_coupon_flag == 0);
+		TEST_CHECK(coupon.dont_multiply_flag == 1);
+
+		TEST_CHECK(gs1_parse_couponcode("1061414112345611110123", 22, NULL, NULL, &coupon) == GS1_LINTER_OK);
+		TEST_CHECK(coupon.fields == 0);
+		TEST_CHECK(coupon.gcp.pos == 1 && coupon.gcp.len == 7);
+		TEST_CHECK(coupon.save_value == 1);
+		TEST_CHECK(coupon.purchase[1].requirement == 0);
+		TEST_CHECK(coupon.expiration_date.year == 0);
+		TEST_CHECK(coupon.serial_number.len == 0);
+
+		TEST_CHECK(gs1_parse_couponcode("1061414112345611110123x", 23, &pos, &len, &coupon) == GS1_LINTER_NON_DIGIT_CHARACTER);
+		TEST_CHECK(pos == 22 && len == 1);
+
+		/*
+		 *  Invalid data found once some fields are decoded leaves the
+		 *  result unchanged.
+		 *
+		 */
+		TEST_CHECK(gs1_parse_couponcode("0614141123456311", 16, &pos, &len, &coupon) == GS1_LINTER_COUPON_TRUNCATED_SAVE_VALUE);
+		TEST_CHECK(coupon.gcp.pos == 1 && coupon.gcp.len == 7);
+		TEST_CHECK(coupon.save_value == 1);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
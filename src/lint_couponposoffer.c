@@ -30,12 +30,90 @@
 
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "gs1syntaxdictionary.h"
 #include "gs1syntaxdictionary-utils.h"
 
 
+/*
+ *  Schema for the fields of a positive offer file coupon, recorded into a
+ *  gs1_parse_posoffer_t: Format Code "0" or "1", Funder ID with VLI "0" to
+ *  "6" giving its length (plus 6), Offer Code, and Serial Number with any VLI
+ *  giving its length (plus 6), with no following data.
+ *
+ */
+/// \cond
+#define POSOFFER_DEST(field) (uint16_t)offsetof(gs1_parse_posoffer_t, field)
+/// \endcond
+
+static const gs1_lint_vli_step_t couponposoffer_schema[] = {
+	{
+		.op = GS1_LINTER_VLI_DIGIT, .digits = GS1_LINTER_VLI_DIGITS(0, 1),
+		.store = GS1_LINTER_VLI_STORE_U8, .dest = POSOFFER_DEST(format_code),
+		.missing = GS1_LINTER_COUPON_MISSING_FORMAT_CODE,
+		.invalid = GS1_LINTER_COUPON_INVALID_FORMAT_CODE
+	},
+	{
+		.op = GS1_LINTER_VLI_VAR, .len = 6, .digits = GS1_LINTER_VLI_DIGITS(0, 6),
+		.store = GS1_LINTER_VLI_STORE_SPAN, .dest = POSOFFER_DEST(funder),
+		.missing = GS1_LINTER_COUPON_MISSING_FUNDER_VLI,
+		.invalid = GS1_LINTER_COUPON_INVALID_FUNDER_LENGTH,
+		.truncated = GS1_LINTER_COUPON_TRUNCATED_FUNDER
+	},
+	{
+		.op = GS1_LINTER_VLI_FIXED, .len = 6,
+		.store = GS1_LINTER_VLI_STORE_U32, .dest = POSOFFER_DEST(offer_code),
+		.truncated = GS1_LINTER_COUPON_TRUNCATED_OFFER_CODE
+	},
+	{
+		.op = GS1_LINTER_VLI_VAR, .len = 6, .digits = GS1_LINTER_VLI_DIGITS(0, 9),
+		.store = GS1_LINTER_VLI_STORE_SPAN, .dest = POSOFFER_DEST(serial_number),
+		.missing = GS1_LINTER_COUPON_MISSING_SERIAL_NUMBER_VLI,
+		.truncated = GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER
+	}
+};
+
+#undef POSOFFER_DEST
+
+
+/*
+ *  Walk the fields of a positive offer file coupon, recording each into
+ *  `posoffer` if it is not NULL. This is shared by the linter and by
+ *  gs1_parse_couponposoffer().
+ *
+ *  Returns as for the linter, but without updating the linter statistics.
+ *
+ */
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t couponposoffer_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_posoffer_t* const posoffer)
+{
+
+	size_t pos;
+
+	assert(data);
+
+	/*
+	 * Data must consist of all digits.
+	 *
+	 */
+	for (pos = 0; pos < data_len; pos++) {
+		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9')) {
+			if (err_pos) *err_pos = pos;
+			if (err_len) *err_len = 1;
+			return GS1_LINTER_NON_DIGIT_CHARACTER;
+		}
+	}
+
+	if (posoffer)
+		memset(posoffer, 0, sizeof(*posoffer));
+
+	return gs1_lint_vli_run(couponposoffer_schema, sizeof(couponposoffer_schema) / sizeof(couponposoffer_schema[0]), NULL, data, data_len, err_pos, err_len, posoffer);
+
+}
+
+
 /**
  * Used to ensure that an AI component conforms to the modernised North
  * American positive offer file coupon code standard, as carried in AI (8112).
@@ -71,132 +149,59 @@
 GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_couponposoffer(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
 {
 
-	size_t pos;
-	int vli;
-	const char *p, *q;
+	gs1_lint_err_t ret;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
+	ret = couponposoffer_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
 
-	/*
-	 * Data must consist of all digits.
-	 *
-	 */
-	for (pos = 0; pos < data_len; pos++) {
-		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
-				GS1_LINTER_NON_DIGIT_CHARACTER,
-				pos,
-				1
-			);
-	}
-
-	p = data;
-	q = data + data_len;
-
-
-	/*
-	 * Validate the Format ID.
-	 *
-	 * Valid Format IDs are "0" and "1".
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_FORMAT_CODE,
-			0,
-			(size_t)(q - data)
-		);
-
-	if (GS1_LINTER_UNLIKELY(*p != '0' && *p != '1'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_FORMAT_CODE,
-			(size_t)(p - data),
-			1
-		);
-
-
-	/*
-	 * Validate the Funder VLI is in the range "0" to "6" and that the
-	 * following Funder ID has the corresponding length (plus 6).
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(++p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_FUNDER_VLI,
-			0,
-			(size_t)(q - data)
-		);
-	if (GS1_LINTER_UNLIKELY(*p > '6'))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_INVALID_FUNDER_LENGTH,
-			(size_t)(p - data),
-			1
-		);
-	vli = *p - '0' + 6;
-
-	if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_FUNDER,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
-
-	p += vli;
-
+	GS1_LINTER_RETURN_OK;
 
-	/*
-	 * Validate the existence of the six digit Offer Code.
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(q - p < 6))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_OFFER_CODE,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
+}
 
-	p += 6;
 
+#ifndef GS1_LINTER_NO_PARSE
 
-	/*
-	 * Validate that the Serial Number follows its VLI and has the
-	 * corresponding length (plus 6).
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p == q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_MISSING_SERIAL_NUMBER_VLI,
-			0,
-			(size_t)(q - data)
-		);
-	vli = *p - '0' + 6;
+/**
+ * Companion to gs1_lint_couponposoffer() that also returns the fields of the
+ * coupon, recorded as the data is validated.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] posoffer Receives the decoded fields if the data is valid,
+ *                       otherwise is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_couponposoffer()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_couponposoffer(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_posoffer_t* const posoffer)
+{
 
-	if (GS1_LINTER_UNLIKELY(q - ++p < vli))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER,
-			(p == q) ? 0                  : (size_t)(p - data),
-			(p == q) ? (size_t)(q - data) : (size_t)(q - p)
-		);
+	gs1_parse_posoffer_t decoded;
+	gs1_lint_err_t ret;
 
-	p += vli;
+	assert(data);
+	assert(posoffer);
 
+	ret = couponposoffer_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
 
-	/*
-	 * Report any excess data that follows the Serial Number.
-	 *
-	 */
-	if (GS1_LINTER_UNLIKELY(p != q))
-		GS1_LINTER_RETURN_ERROR(
-			GS1_LINTER_COUPON_EXCESS_DATA,
-			(size_t)(p - data),
-			(size_t)(q - p)
-		);
+	*posoffer = decoded;
 
-	GS1_LINTER_RETURN_OK;
+	return GS1_LINTER_OK;
 
 }
 
+#endif  /* GS1_LINTER_NO_PARSE */
+
 
 #ifdef UNIT_TESTS
 
@@ -288,6 +293,27 @@ void test_lint_couponposoffer(void)
 	UNIT_TEST_PASS(gs1_lint_couponposoffer, "061234567890121234569123456789012345");
 	UNIT_TEST_FAIL(gs1_lint_couponposoffer, "0612345678901212345691234567890123456", GS1_LINTER_COUPON_EXCESS_DATA, "061234567890121234569123456789012345*6*");
 
+	{
+		gs1_parse_posoffer_t posoffer;
+		size_t pos, len;
+
+		TEST_CHECK(gs1_parse_couponposoffer("1212345678901234" "9" "123456789012345", 32, NULL, NULL, &posoffer) == GS1_LINTER_OK);
+		TEST_CHECK(posoffer.format_code == 1);
+		TEST_CHECK(posoffer.funder.pos == 2 && posoffer.funder.len == 8);
+		TEST_CHECK(posoffer.offer_code == 901234);
+		TEST_CHECK(posoffer.serial_number.pos == 17 && posoffer.serial_number.len == 15);
+
+		TEST_CHECK(gs1_parse_couponposoffer("001234561234560123456", 21, &pos, &len, &posoffer) == GS1_LINTER_OK);
+		TEST_CHECK(posoffer.format_code == 0 && posoffer.offer_code == 123456);
+
+		TEST_CHECK(gs1_parse_couponposoffer("0012345612345601234567", 22, &pos, &len, &posoffer) == GS1_LINTER_COUPON_EXCESS_DATA);
+		TEST_CHECK(pos == 21 && len == 1);
+		TEST_CHECK(posoffer.format_code == 0 && posoffer.offer_code == 123456);	// Unchanged
+
+		TEST_CHECK(gs1_parse_couponposoffer("1212345678901234" "9" "1234567890123", 30, &pos, &len, &posoffer) == GS1_LINTER_COUPON_TRUNCATED_SERIAL_NUMBER);
+		TEST_CHECK(posoffer.format_code == 0 && posoffer.offer_code == 123456 && posoffer.funder.len == 6);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
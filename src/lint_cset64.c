@@ -72,6 +72,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset64(const char* const data,
 	size_t pads, len, pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -108,6 +109,45 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset64(const char* const data,
 }
 
 
+#ifndef GS1_LINTER_NO_VALID
+
+/**
+ * Determine whether data conforms to `Z..99` syntax and has valid padding, as gs1_lint_cset64()
+ * does, but without locating the first invalid character.
+ *
+ * @param [in] data Pointer to the data to be checked. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be checked.
+ *
+ * @return `true` if gs1_lint_cset64() would return #GS1_LINTER_OK, otherwise
+ *         `false`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_cset64_valid(const char* const data, const size_t data_len)
+{
+
+	/*
+	 * CSET 64 characters: ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_
+	 *
+	 */
+	static const gs1_lint_range_t cset64_ranges[] = {
+		{ '-', '-' }, { '0', '9' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' }
+	};
+
+	size_t pads;
+
+	assert(data);
+
+	for (pads = 0; pads < data_len && data[data_len - pads - 1] == '='; pads++);
+	if (GS1_LINTER_UNLIKELY(pads > 2 || (pads > 0 && data_len % 3 != 0)))
+		return false;
+
+	return gs1_lint_ranges_all(cset64_ranges, sizeof(cset64_ranges) / sizeof(cset64_ranges[0]), data, data_len - pads);
+
+}
+
+#endif  /* GS1_LINTER_NO_VALID */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -115,6 +155,8 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset64(const char* const data,
 void test_lint_cset64(void)
 {
 
+	UNIT_TEST_VALID(gs1_lint_cset64, gs1_lint_cset64_valid, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789=");
+
 	UNIT_TEST_PASS(gs1_lint_cset64, "");
 
 	// Padding is optional
@@ -71,6 +71,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset82(const char* const data,
 	size_t pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -93,6 +94,39 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset82(const char* const data,
 }
 
 
+#ifndef GS1_LINTER_NO_VALID
+
+/**
+ * Determine whether data conforms to `X..99` syntax, as gs1_lint_cset82()
+ * does, but without locating the first invalid character.
+ *
+ * @param [in] data Pointer to the data to be checked. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be checked.
+ *
+ * @return `true` if gs1_lint_cset82() would return #GS1_LINTER_OK, otherwise
+ *         `false`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_cset82_valid(const char* const data, const size_t data_len)
+{
+
+	/*
+	 * CSET 82 characters: !"%&'()*+,-./0123456789:;<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz
+	 *
+	 */
+	static const gs1_lint_range_t cset82_ranges[] = {
+		{ '!', '"' }, { '%', '?' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' }
+	};
+
+	assert(data);
+
+	return gs1_lint_ranges_all(cset82_ranges, sizeof(cset82_ranges) / sizeof(cset82_ranges[0]), data, data_len);
+
+}
+
+#endif  /* GS1_LINTER_NO_VALID */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -100,6 +134,8 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_cset82(const char* const data,
 void test_lint_cset82(void)
 {
 
+	UNIT_TEST_VALID(gs1_lint_cset82, gs1_lint_cset82_valid, "!\"%&'()*+,-./0123456789:;<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz");
+
 	UNIT_TEST_PASS(gs1_lint_cset82, "");
 	UNIT_TEST_PASS(gs1_lint_cset82, "!\"%&'()*+,-/012345");
 	UNIT_TEST_PASS(gs1_lint_cset82, "6789:;<=>?ABCDEFGHIJ");
@@ -55,6 +55,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_csetnumeric(const char* const
 	size_t pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -74,6 +75,33 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_csetnumeric(const char* const
 }
 
 
+#ifndef GS1_LINTER_NO_VALID
+
+/**
+ * Determine whether data conforms to `N..99` syntax, as gs1_lint_csetnumeric()
+ * does, but without locating the first invalid character.
+ *
+ * @param [in] data Pointer to the data to be checked. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be checked.
+ *
+ * @return `true` if gs1_lint_csetnumeric() would return #GS1_LINTER_OK, otherwise
+ *         `false`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API bool gs1_lint_csetnumeric_valid(const char* const data, const size_t data_len)
+{
+
+	static const gs1_lint_range_t digits[] = { { '0', '9' } };
+
+	assert(data);
+
+	return gs1_lint_ranges_all(digits, 1, data, data_len);
+
+}
+
+#endif  /* GS1_LINTER_NO_VALID */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -81,6 +109,8 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_csetnumeric(const char* const
 void test_lint_csetnumeric(void)
 {
 
+	UNIT_TEST_VALID(gs1_lint_csetnumeric, gs1_lint_csetnumeric_valid, "0123456789012345678901234567890123456789");
+
 	UNIT_TEST_PASS(gs1_lint_csetnumeric, "");
 	UNIT_TEST_PASS(gs1_lint_csetnumeric, "0");
 	UNIT_TEST_PASS(gs1_lint_csetnumeric, "9");
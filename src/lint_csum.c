@@ -61,6 +61,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_csum(const char* const data, s
 	int parity = 0;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	/*
 	 * Data must include at least the check digit.
@@ -116,6 +116,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_csumalpha(const char* const da
 	uint32_t sum = 0;	/* Sufficient for 97-prime implementation */
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
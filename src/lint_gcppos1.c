@@ -105,6 +105,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_gcppos1(const char* const data
 	size_t i;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	/*
 	 * Any character within the minimum-length GCP prefix that is outside
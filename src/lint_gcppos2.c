@@ -60,6 +60,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_gcppos2(const char* const data
 	gs1_lint_err_t ret;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	if (GS1_LINTER_UNLIKELY(data_len < 2))
 		GS1_LINTER_RETURN_ERROR(
@@ -51,6 +51,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hasnondigit(const char* const
 	size_t pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	/*
 	 * Data must not be all numeric
@@ -32,25 +32,14 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to ensure that an AI component conforms to HHMI format.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a time of day, recording it into `hhmi` if it is not NULL. This is
+ *  shared by the linter and by gs1_parse_hhmi().
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_HOUR_WITH_MINUTE_TOO_SHORT if the data is too short for HHMI format.
- * @return #GS1_LINTER_HOUR_WITH_MINUTE_TOO_LONG if the data is too long for HHMI format.
- * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
- * @return #GS1_LINTER_ILLEGAL_HOUR if the data contains an invalid hour.
- * @return #GS1_LINTER_ILLEGAL_MINUTE if the data contains an invalid minute.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hhmi(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t hhmi_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_time_t* const hhmi)
 {
 
 	gs1_lint_err_t ret;
@@ -62,7 +51,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hhmi(const char* const data, s
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(data_len != 4))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			data_len < 4 ? GS1_LINTER_HOUR_WITH_MINUTE_TOO_SHORT : GS1_LINTER_HOUR_WITH_MINUTE_TOO_LONG,
 			0,
 			data_len
@@ -75,7 +64,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hhmi(const char* const data, s
 	       ret == GS1_LINTER_ILLEGAL_HOUR);
 
 	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+		GS1_LINTER_DECODE_ERROR(ret, *err_pos, *err_len);
 
 	ret = gs1_lint_mi(data + 2, 2, err_pos, err_len);
 
@@ -84,13 +73,94 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hhmi(const char* const data, s
 	       ret == GS1_LINTER_ILLEGAL_MINUTE);
 
 	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-		GS1_LINTER_RETURN_ERROR(ret, *err_pos + 2, *err_len);
+		GS1_LINTER_DECODE_ERROR(ret, *err_pos + 2, *err_len);
+
+	if (hhmi) {
+		hhmi->hour = (uint8_t)((data[0] - '0') * 10 + (data[1] - '0'));
+		hhmi->minute = (uint8_t)((data[2] - '0') * 10 + (data[3] - '0'));
+		hhmi->minutes = (uint16_t)(hhmi->hour * 60 + hhmi->minute);
+	}
+
+	return GS1_LINTER_OK;
+
+}
+
+
+/**
+ * Used to ensure that an AI component conforms to HHMI format.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_HOUR_WITH_MINUTE_TOO_SHORT if the data is too short for HHMI format.
+ * @return #GS1_LINTER_HOUR_WITH_MINUTE_TOO_LONG if the data is too long for HHMI format.
+ * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
+ * @return #GS1_LINTER_ILLEGAL_HOUR if the data contains an invalid hour.
+ * @return #GS1_LINTER_ILLEGAL_MINUTE if the data contains an invalid minute.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hhmi(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = hhmi_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
 
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_hhmi() that also returns the time of day that the
+ * data represents.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] hhmi Receives the decoded value if the data is valid, otherwise
+ *                   is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_hhmi()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_hhmi(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_time_t* const hhmi)
+{
+
+	gs1_parse_time_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(hhmi);
+
+	ret = hhmi_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*hhmi = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -198,6 +268,18 @@ void test_lint_hhmi(void)
 	UNIT_TEST_FAIL(gs1_lint_hhmi, "111",   GS1_LINTER_HOUR_WITH_MINUTE_TOO_SHORT, "*111*");
 	UNIT_TEST_FAIL(gs1_lint_hhmi, "11111", GS1_LINTER_HOUR_WITH_MINUTE_TOO_LONG,  "*11111*");
 
+	{
+		gs1_parse_time_t hhmi;
+
+		TEST_CHECK(gs1_parse_hhmi("0000", 4, NULL, NULL, &hhmi) == GS1_LINTER_OK);
+		TEST_CHECK(hhmi.hour == 0 && hhmi.minute == 0 && hhmi.minutes == 0);
+		TEST_CHECK(gs1_parse_hhmi("2359", 4, NULL, NULL, &hhmi) == GS1_LINTER_OK);
+		TEST_CHECK(hhmi.hour == 23 && hhmi.minute == 59 && hhmi.minutes == 1439);
+
+		TEST_CHECK(gs1_parse_hhmi("2360", 4, NULL, NULL, &hhmi) == GS1_LINTER_ILLEGAL_MINUTE);
+		TEST_CHECK(hhmi.minutes == 1439);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
@@ -50,6 +50,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_hyphen(const char* const data,
 	size_t pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	if (GS1_LINTER_UNLIKELY(data_len == 0))
 		GS1_LINTER_RETURN_ERROR(
@@ -85,6 +85,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_iban(const char* const data, s
 	};
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	/*
 	 * Require at least 4 characters before main loop
@@ -72,6 +72,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_importeridx(const char* const
 	int valid;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
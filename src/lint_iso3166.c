@@ -130,6 +130,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_iso3166(const char* const data
 
 /// \cond
 #define GS1_LINTER_ISO3166_LOOKUP(cc, cc_len, valid) do {					\
+	if (GS1_LINTER_CODELIST_LOOKUP(GS1_LINTER_CODELIST_ISO3166, cc, cc_len, valid)) break;	\
 	valid = 0;										\
 	if (cc_len == 3 && isdigit((int)cc[0]) && isdigit((int)cc[1]) && isdigit((int)cc[2])) {	\
 		int v = (cc[0] - '0') * 100 + (cc[1] - '0') * 10 + cc[2] - '0';			\
@@ -143,6 +144,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_iso3166(const char* const data
 	int valid;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
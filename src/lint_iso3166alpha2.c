@@ -123,6 +123,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_iso3166alpha2(const char* cons
 
 /// \cond
 #define GS1_LINTER_ISO3166ALPHA2_LOOKUP(cc, cc_len, valid) do {					\
+	if (GS1_LINTER_CODELIST_LOOKUP(GS1_LINTER_CODELIST_ISO3166ALPHA2, cc, cc_len, valid)) break; \
 	valid = 0;										\
 	if (cc_len == 2 && cc[0] >= 'A' && cc[0] <= 'Z' && cc[1] >= 'A' && cc[1] <= 'Z') {	\
 		int v = (cc[0] - 'A') * 26 + cc[1] - 'A';					\
@@ -136,6 +137,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_iso3166alpha2(const char* cons
 	int valid;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	/*
 	 * Ensure that the data is in the list.
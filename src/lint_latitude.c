@@ -31,23 +31,14 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to validate that an AI component represents the latitude component of a
- * WGS84 coordinate expressed as a 10-digit number.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a latitude, recording it into `coord` if it is not NULL. This is
+ *  shared by the linter and by gs1_parse_latitude().
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_LATITUDE_INVALID_LENGTH if the latitude does not have length 10.
- * @return #GS1_LINTER_INVALID_LATITUDE if the latitude is outside the range `0000000000` - `1800000000`.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_latitude(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t latitude_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_coord_t* const coord)
 {
 
 	size_t pos;
@@ -60,7 +51,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_latitude(const char* const dat
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(data_len != 10))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_LATITUDE_INVALID_LENGTH,
 			0,
 			data_len
@@ -73,7 +64,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_latitude(const char* const dat
 	 */
 	for (pos = 0, value = 0; pos < data_len; pos++) {
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_NON_DIGIT_CHARACTER,
 				pos,
 				1
@@ -82,17 +73,93 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_latitude(const char* const dat
 	}
 
 	if (GS1_LINTER_UNLIKELY(value > 1800000000))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_INVALID_LATITUDE,
 			0,
 			10
 		);
 
+	if (coord)
+		coord->e7 = (int32_t)((int64_t)value - 900000000);
+
+	return GS1_LINTER_OK;
+
+}
+
+
+/**
+ * Used to validate that an AI component represents the latitude component of a
+ * WGS84 coordinate expressed as a 10-digit number.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_LATITUDE_INVALID_LENGTH if the latitude does not have length 10.
+ * @return #GS1_LINTER_INVALID_LATITUDE if the latitude is outside the range `0000000000` - `1800000000`.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_latitude(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = latitude_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_latitude() that also returns the latitude in fixed-point
+ * form, as signed degrees in units of 10^-7.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] coord Receives the decoded value if the data is valid, otherwise
+ *                    is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_latitude()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_latitude(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_coord_t* const coord)
+{
+
+	gs1_parse_coord_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(coord);
+
+	ret = latitude_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*coord = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -111,6 +178,20 @@ void test_lint_latitude(void)
 
 	UNIT_TEST_FAIL(gs1_lint_latitude, "1800000001", GS1_LINTER_INVALID_LATITUDE, "*1800000001*");
 
+	{
+		gs1_parse_coord_t coord;
+
+		TEST_CHECK(gs1_parse_latitude("0000000000", 10, NULL, NULL, &coord) == GS1_LINTER_OK);
+		TEST_CHECK(coord.e7 == -900000000);
+		TEST_CHECK(gs1_parse_latitude("0900000000", 10, NULL, NULL, &coord) == GS1_LINTER_OK);
+		TEST_CHECK(coord.e7 == 0);
+		TEST_CHECK(gs1_parse_latitude("1800000000", 10, NULL, NULL, &coord) == GS1_LINTER_OK);
+		TEST_CHECK(coord.e7 == 900000000);
+
+		TEST_CHECK(gs1_parse_latitude("1800000001", 10, NULL, NULL, &coord) != GS1_LINTER_OK);
+		TEST_CHECK(coord.e7 == 900000000);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
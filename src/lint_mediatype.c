@@ -122,6 +122,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_mediatype(const char* const da
 
 /// \cond
 #define GS1_LINTER_MEDIA_TYPE_LOOKUP(cc, cc_len, valid) do {			\
+	if (GS1_LINTER_CODELIST_LOOKUP(GS1_LINTER_CODELIST_MEDIA_TYPE, cc, cc_len, valid)) break; \
 	valid = 0;								\
 	if (cc_len == 2 && isdigit((int)cc[0]) && isdigit((int)cc[1])) {	\
 		int v = (cc[0] - '0') * 10 + (cc[1] - '0');			\
@@ -135,6 +136,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_mediatype(const char* const da
 	int valid;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
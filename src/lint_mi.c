@@ -56,6 +56,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_mi(const char* const data, siz
 	int pos;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -53,6 +53,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_nonzero(const char* const data
 	int has_nonzero = 0;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 	for (pos = 0; pos < data_len; pos++) {
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
@@ -30,6 +30,7 @@
 
 
 #include <assert.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "gs1syntaxdictionary.h"
@@ -52,8 +53,9 @@
  * Used to validate that an AI component is a valid package type as defined by
  * the PackageTypeCode code list.
  *
- * @note The default lookup function provided by this linter is a binary search
- *       over a static list this is maintained in this file.
+ * @note The default lookup function provided by this linter uses a bit field
+ *       for one- and two-character codes and a binary search over a static
+ *       list for three-character codes, both maintained in this file.
  * @note To enable this linter to hook into an alternative PackageTypeCode
  *       lookup function (provided by the user) the
  *       GS1_LINTER_CUSTOM_PACKAGE_TYPE_LOOKUP_H macro may be set to the name of a
@@ -88,53 +90,99 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_packagetype(const char* const
 #else
 
 	/*
-	 *  Set of valid PackageTypeCode value, in lexicographic order
+	 *  Set of valid one- and two-character PackageTypeCode values, as a
+	 *  bit field with one element for each possible first character.
+	 *  Position 0 of an element is set if the first character alone is a
+	 *  valid code, and position 1 + n is set if the first character
+	 *  followed by the nth character of "0-9A-Z" is a valid code.
 	 *
 	 *  MAINTENANCE NOTE:
 	 *
 	 *  Updates must be aligned with the PackageTypeCode code list
 	 *
 	 */
-	static const char packagetypes[][4] = {
-		"1A", "1B", "1D", "1F", "1G", "1W",
-		"200", "201", "202", "203", "204", "205", "206", "210", "211", "212", "2C",
-		"3A", "3H",
-		"43", "44", "4A", "4B", "4C", "4D", "4F", "4G", "4H",
-		"5H", "5L", "5M",
-		"6H", "6P",
-		"7A", "7B",
-		"8", "8A", "8B", "8C",
-		"9",
-		"AA", "AB", "AC", "AD", "AF", "AG", "AH", "AI", "AJ", "AL", "AM", "AP", "APE","AT", "AV",
-		"B4", "BB", "BC", "BD", "BE", "BF", "BG", "BGE", "BH", "BI", "BJ", "BK", "BL", "BM", "BME", "BN", "BO", "BP", "BQ", "BR", "BRI", "BS", "BT", "BU", "BV", "BW", "BX", "BY", "BZ",
-		"CA", "CB", "CBL", "CC", "CCE", "CD", "CE", "CF", "CG", "CH", "CI", "CJ", "CK", "CL", "CM", "CN", "CO", "CP", "CQ", "CR", "CS", "CT", "CU", "CV", "CW", "CX", "CY", "CZ",
-		"DA", "DB", "DC", "DG", "DH", "DI", "DJ", "DK", "DL", "DM", "DN", "DP", "DPE", "DR", "DS", "DT", "DU", "DV", "DW", "DX", "DY",
-		"E1", "E2", "E3", "EC", "ED", "EE", "EF", "EG", "EH", "EI", "EN",
-		"FB", "FC", "FD", "FE", "FI", "FL", "FO", "FOB", "FP", "FPE", "FR", "FT", "FW", "FX",
-		"GB", "GI", "GL", "GR", "GU", "GY", "GZ",
-		"HA", "HB", "HC", "HG", "HN", "HR",
-		"IA", "IB", "IC", "ID", "IE", "IF", "IG", "IH", "IK", "IL", "IN", "IZ",
-		"JB", "JC", "JG", "JR", "JT", "JY",
-		"KG", "KI",
-		"LAB", "LE", "LG", "LT", "LU", "LV", "LZ",
-		"MA", "MB", "MC", "ME", "MPE", "MR", "MS", "MT", "MW", "MX",
-		"NA", "NE", "NF", "NG", "NS", "NT", "NU", "NV",
-		"OA", "OB", "OC", "OD", "OE", "OF", "OK", "OPE", "OT", "OU",
-		"P2", "PA", "PAE", "PB", "PC", "PD", "PE", "PF", "PG", "PH", "PI", "PJ", "PK", "PL", "PLP", "PN", "PO", "POP", "PP", "PPE", "PR", "PT", "PU", "PUE", "PV", "PX", "PY", "PZ",
-		"QA", "QB", "QC", "QD", "QF", "QG", "QH", "QJ", "QK", "QL", "QM", "QN", "QP", "QQ", "QR", "QS",
-		"RB1", "RB2", "RB3", "RCB", "RD", "RG", "RJ", "RK", "RL", "RO", "RT", "RZ",
-		"S1", "SA", "SB", "SC", "SD", "SE", "SEC", "SH", "SI", "SK", "SL", "SM", "SO", "SP", "SS", "ST", "STL", "SU", "SV", "SW", "SX", "SY", "SZ",
-		"T1", "TB", "TC", "TD", "TE", "TEV", "TG", "THE", "TI", "TK", "TL", "TN", "TO", "TR", "TRE", "TS", "TT", "TTE", "TU", "TV", "TW", "TWE", "TY", "TZ",
-		"UC", "UN", "UUE",
-		"VA", "VG", "VI", "VK", "VL", "VN", "VO", "VP", "VQ", "VR", "VS", "VY",
-		"WA", "WB", "WC", "WD", "WF", "WG", "WH", "WJ", "WK", "WL", "WM", "WN", "WP", "WQ", "WR", "WRP", "WS", "WT", "WU", "WV", "WW", "WX", "WY", "WZ",
-		"X11", "X12", "X15", "X16", "X17", "X18", "X19", "X20", "X3", "XA", "XB", "XC", "XD", "XF", "XG", "XH", "XJ", "XK",
-		"YA", "YB", "YC", "YD", "YF", "YG", "YH", "YJ", "YK", "YL", "YM", "YN", "YP", "YQ", "YR", "YS", "YT", "YV", "YW", "YX", "YY", "YZ",
-		"ZA", "ZB", "ZC", "ZD", "ZF", "ZG", "ZH", "ZJ", "ZK", "ZL", "ZM", "ZN", "ZP", "ZQ", "ZR", "ZS", "ZT", "ZU", "ZV", "ZW", "ZX", "ZY", "ZZ",
+	static const uint64_t packagetypes[] = {
+		0x0000000000000000,  // 0: -
+		0x001ac00040000000,  // 1: 1A 1B 1D 1F 1G 1W
+		0x0004000000000000,  // 2: 2C
+		0x0010200000000000,  // 3: 3A 3H
+		0x0c1ee00000000000,  // 4: 43 44 4A 4B 4C 4D 4F 4G 4H
+		0x0000230000000000,  // 5: 5H 5L 5M
+		0x0000202000000000,  // 6: 6H 6P
+		0x0018000000000000,  // 7: 7A 7B
+		0x801c000000000000,  // 8: 8 8A 8B 8C
+		0x8000000000000000,  // 9: 9
+		0x001efb2280000000,  // A: AA AB AC AD AF AG AH AI AJ AL AM AP AT AV
+		0x040ffffff8000000,  // B: B4 BB BC BD BE BF BG BH BI BJ BK BL BM BN BO BP BQ BR BS BT BU BV BW BX BY BZ
+		0x001ffffff8000000,  // C: CA CB CC CD CE CF CG CH CI CJ CK CL CM CN CO CP CQ CR CS CT CU CV CW CX CY CZ
+		0x001c7faff0000000,  // D: DA DB DC DG DH DI DJ DK DL DM DN DP DR DS DT DU DV DW DX DY
+		0x3807f08000000000,  // E: E1 E2 E3 EC ED EE EF EG EH EI EN
+		0x000f126a60000000,  // F: FB FC FD FE FI FL FO FP FR FT FW FX
+		0x0008120918000000,  // G: GB GI GL GR GU GY GZ
+		0x001c408800000000,  // H: HA HB HC HG HN HR
+		0x001fe68008000000,  // I: IA IB IC ID IE IF IG IH IK IL IN IZ
+		0x000c400a10000000,  // J: JB JC JG JR JT JY
+		0x0000500000000000,  // K: KG KI
+		0x0001400388000000,  // L: LE LG LT LU LV LZ
+		0x001d000e60000000,  // M: MA MB MC ME MR MS MT MW MX
+		0x0011c00780000000,  // N: NA NE NF NG NS NT NU NV
+		0x001f840300000000,  // O: OA OB OC OD OE OF OK OT OU
+		0x101ffeebb8000000,  // P: P2 PA PB PC PD PE PF PG PH PI PJ PK PL PN PO PP PR PT PU PV PX PY PZ
+		0x001eefbc00000000,  // Q: QA QB QC QD QF QG QH QJ QK QL QM QN QP QQ QR QS
+		0x00024e4208000000,  // R: RD RG RJ RK RL RO RT RZ
+		0x201f3767f8000000,  // S: S1 SA SB SC SD SE SH SI SK SL SM SO SP SS ST SU SV SW SX SY SZ
+		0x200f56cfd8000000,  // T: T1 TB TC TD TE TG TI TK TL TN TO TR TS TT TU TV TW TY TZ
+		0x0004008000000000,  // U: UC UN
+		0x001056fc10000000,  // V: VA VG VI VK VL VN VO VP VQ VR VS VY
+		0x001eefbff8000000,  // W: WA WB WC WD WF WG WH WJ WK WL WM WN WP WQ WR WS WT WU WV WW WX WY WZ
+		0x081eec0000000000,  // X: X3 XA XB XC XD XF XG XH XJ XK
+		0x001eefbef8000000,  // Y: YA YB YC YD YF YG YH YJ YK YL YM YN YP YQ YR YS YT YV YW YX YY YZ
+		0x001eefbff8000000,  // Z: ZA ZB ZC ZD ZF ZG ZH ZJ ZK ZL ZM ZN ZP ZQ ZR ZS ZT ZU ZV ZW ZX ZY ZZ
+	};
+
+	/*
+	 *  Set of valid three-character PackageTypeCode values, in
+	 *  lexicographic order
+	 *
+	 */
+	static const char packagetypes3[][4] = {
+		"200", "201", "202", "203", "204", "205", "206", "210", "211", "212",
+		"APE",
+		"BGE", "BME", "BRI",
+		"CBL", "CCE",
+		"DPE",
+		"FOB", "FPE",
+		"LAB",
+		"MPE",
+		"OPE",
+		"PAE", "PLP", "POP", "PPE", "PUE",
+		"RB1", "RB2", "RB3", "RCB",
+		"SEC", "STL",
+		"TEV", "THE", "TRE", "TTE", "TWE",
+		"UUE",
+		"WRP",
+		"X11", "X12", "X15", "X16", "X17", "X18", "X19", "X20",
 	};
 
 /// \cond
-#define GS1_LINTER_PACKAGE_TYPE_LOOKUP(cc, cc_len, valid) GS1_LINTER_BINARY_SEARCH(cc, cc_len, packagetypes, valid)
+#define GS1_LINTER_PACKAGE_TYPE_INDEX(c)					\
+	((c) >= '0' && (c) <= '9' ? (c) - '0' :					\
+	 (c) >= 'A' && (c) <= 'Z' ? (c) - 'A' + 10 : -1)
+
+#define GS1_LINTER_PACKAGE_TYPE_LOOKUP(cc, cc_len, valid) do {						\
+	int c0, c1;											\
+	if (GS1_LINTER_CODELIST_LOOKUP(GS1_LINTER_CODELIST_PACKAGE_TYPE, cc, cc_len, valid)) break;	\
+	if (cc_len == 3) {										\
+		GS1_LINTER_BINARY_SEARCH(cc, cc_len, packagetypes3, valid);				\
+		break;											\
+	}												\
+	valid = 0;											\
+	if (cc_len == 0 || cc_len > 2 || (c0 = GS1_LINTER_PACKAGE_TYPE_INDEX(cc[0])) < 0) break;	\
+	c1 = 0;												\
+	if (cc_len == 2 && (c1 = 1 + GS1_LINTER_PACKAGE_TYPE_INDEX(cc[1])) == 0) break;		\
+	c0 = c0 * 64 + c1;										\
+	GS1_LINTER_BITFIELD_LOOKUP(c0, packagetypes, valid);						\
+} while (0)
 /// \endcond
 
 #endif
@@ -142,6 +190,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_packagetype(const char* const
 	int valid;
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -183,6 +232,13 @@ void test_lint_packagetype(void)
 	UNIT_TEST_FAIL(gs1_lint_packagetype, "1A_", GS1_LINTER_INVALID_PACKAGE_TYPE, "*1A_*");
 	UNIT_TEST_FAIL(gs1_lint_packagetype, "_200", GS1_LINTER_INVALID_PACKAGE_TYPE, "*_200*");
 	UNIT_TEST_FAIL(gs1_lint_packagetype, "200_", GS1_LINTER_INVALID_PACKAGE_TYPE, "*200_*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "7", GS1_LINTER_INVALID_PACKAGE_TYPE, "*7*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "8D", GS1_LINTER_INVALID_PACKAGE_TYPE, "*8D*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "1a", GS1_LINTER_INVALID_PACKAGE_TYPE, "*1a*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "a1", GS1_LINTER_INVALID_PACKAGE_TYPE, "*a1*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "Z/", GS1_LINTER_INVALID_PACKAGE_TYPE, "*Z/*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "Z[", GS1_LINTER_INVALID_PACKAGE_TYPE, "*Z[*");
+	UNIT_TEST_FAIL(gs1_lint_packagetype, "APF", GS1_LINTER_INVALID_PACKAGE_TYPE, "*APF*");
 
 	UNIT_TEST_PASS(gs1_lint_packagetype, "1A");
 	UNIT_TEST_PASS(gs1_lint_packagetype, "1B");
@@ -33,26 +33,15 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to ensure that an AI component conforms to a PPTT format, where PP and
- * TT have equal width.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a piece of total, recording the piece number and total into
+ *  `piece` if it is not NULL. This is shared by the linter and by
+ *  gs1_parse_pieceoftotal().
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_INVALID_LENGTH_FOR_PIECE_OF_TOTAL if the data is not an even length.
- * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
- * @return #GS1_LINTER_ZERO_PIECE_NUMBER if the data contains a piece number with a zero value.
- * @return #GS1_LINTER_ZERO_TOTAL_PIECES if the data contains a total piece count with a zero value.
- * @return #GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL if the data contains a piece number that is larger than the total piece count.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t pieceoftotal_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_piece_t* const piece)
 {
 
 /// \cond
@@ -71,7 +60,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const
 	 */
 	for (pos = 0; pos < data_len; pos++)
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_NON_DIGIT_CHARACTER,
 				pos,
 				1
@@ -82,7 +71,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(data_len == 0 || data_len % 2 != 0))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_INVALID_LENGTH_FOR_PIECE_OF_TOTAL,
 			0,
 			data_len
@@ -90,15 +79,22 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const
 
 	/*
 	 * Determine whether either the piece number or total piece count is
-	 * zero and whether the piece number exceeds the total piece count.
+	 * zero and whether the piece number exceeds the total piece count,
+	 * recording both if requested.
 	 *
 	 */
+	if (piece)
+		piece->piece = piece->total = 0;
 	pieceiszero = totaliszero = 1;
 	compare = 0;				/* -1:P<T ; 0:P==T ; 1:P>T */
 	for (i = 0; i < data_len / 2; i++) {
 		if (pieceiszero && P(i) != '0') pieceiszero = 0;
 		if (totaliszero && T(i) != '0') totaliszero = 0;
 		if (!compare && P(i) != T(i)) compare = P(i) < T(i) ? -1 : 1;
+		if (piece) {
+			piece->piece = gs1_parse_digit_append(piece->piece, P(i));
+			piece->total = gs1_parse_digit_append(piece->total, T(i));
+		}
 	}
 
 	/*
@@ -106,7 +102,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(pieceiszero || totaliszero))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			pieceiszero ? GS1_LINTER_ZERO_PIECE_NUMBER : GS1_LINTER_ZERO_TOTAL_PIECES,
 			pieceiszero ? 0 : data_len / 2,
 			data_len / 2
@@ -117,17 +113,96 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(compare == 1))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL,
 			0,
 			data_len
 		);
 
+	return GS1_LINTER_OK;
+
+}
+
+#undef P
+#undef T
+
+
+/**
+ * Used to ensure that an AI component conforms to a PPTT format, where PP and
+ * TT have equal width.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_INVALID_LENGTH_FOR_PIECE_OF_TOTAL if the data is not an even length.
+ * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
+ * @return #GS1_LINTER_ZERO_PIECE_NUMBER if the data contains a piece number with a zero value.
+ * @return #GS1_LINTER_ZERO_TOTAL_PIECES if the data contains a total piece count with a zero value.
+ * @return #GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL if the data contains a piece number that is larger than the total piece count.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_pieceoftotal(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = pieceoftotal_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_pieceoftotal() that also returns the piece number and
+ * total piece count.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] piece Receives the decoded value if the data is valid, otherwise
+ *                    is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_pieceoftotal()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_pieceoftotal(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_piece_t* const piece)
+{
+
+	gs1_parse_piece_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(piece);
+
+	ret = pieceoftotal_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*piece = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -193,6 +268,20 @@ void test_lint_pieceoftotal(void)
 	UNIT_TEST_FAIL(gs1_lint_pieceoftotal, "101100", GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL, "*101100*");
 	UNIT_TEST_FAIL(gs1_lint_pieceoftotal, "999998", GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL, "*999998*");
 
+	{
+		gs1_parse_piece_t piece;
+
+		TEST_CHECK(gs1_parse_pieceoftotal("0203", 4, NULL, NULL, &piece) == GS1_LINTER_OK);
+		TEST_CHECK(piece.piece == 2 && piece.total == 3);
+		TEST_CHECK(gs1_parse_pieceoftotal("0000000000000000000118446744073709551615", 40, NULL, NULL, &piece) == GS1_LINTER_OK);
+		TEST_CHECK(piece.piece == 1 && piece.total == UINT64_MAX);
+		TEST_CHECK(gs1_parse_pieceoftotal("0000000000000000000199999999999999999999", 40, NULL, NULL, &piece) == GS1_LINTER_OK);
+		TEST_CHECK(piece.piece == 1 && piece.total == UINT64_MAX);
+
+		TEST_CHECK(gs1_parse_pieceoftotal("21", 2, NULL, NULL, &piece) == GS1_LINTER_PIECE_NUMBER_EXCEEDS_TOTAL);
+		TEST_CHECK(piece.piece == 1);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
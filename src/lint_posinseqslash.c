@@ -32,24 +32,15 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to ensure that an AI component conforms to a "`<pos>/<end>`" format for
- * variable width `<pos>` and `<end>`.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a position in sequence, recording the position and end into
+ *  `piece` if it is not NULL. This is shared by the linter and by
+ *  gs1_parse_posinseqslash().
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED if the data does not conform to "`<pos>/<end>`" format.
- * @return #GS1_LINTER_ILLEGAL_ZERO_PREFIX if either the position number or the end number are zero or contain a zero prefix.
- * @return #GS1_LINTER_POSITION_EXCEEDS_END if the data contains a position number that is larger than the end position.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t posinseqslash_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_piece_t* const piece)
 {
 
 /// \cond
@@ -65,14 +56,18 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* cons
 	 * First non-digit should be '/'
 	 *
 	 */
-	for (pos = 0; pos < data_len && data[pos] >= '0' && data[pos] <= '9'; pos++);
+	if (piece)
+		piece->piece = piece->total = 0;
+	for (pos = 0; pos < data_len && data[pos] >= '0' && data[pos] <= '9'; pos++)
+		if (piece)
+			piece->piece = gs1_parse_digit_append(piece->piece, data[pos]);
 
 	/*
 	 * Format so far must be digits + '/'
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(pos == 0 || pos >= data_len || data[pos] != '/')) {
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED,
 			0,
 			data_len
@@ -85,20 +80,23 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* cons
 	 * Validate that remaining characters are digits and measure length
 	 *
 	 */
-	for (pos++; pos < data_len; pos++)
+	for (pos++; pos < data_len; pos++) {
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9')) {
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED,
 				0,
 				data_len
 			);
 		}
+		if (piece)
+			piece->total = gs1_parse_digit_append(piece->total, data[pos]);
+	}
 
 	/*
 	 * Must have digits after slash
 	 */
 	if (GS1_LINTER_UNLIKELY(slash_pos >= data_len - 1))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED,
 			0,
 			data_len
@@ -111,7 +109,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* cons
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(P(0) == '0'))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_ILLEGAL_ZERO_PREFIX,
 			0,
 			pos
@@ -122,7 +120,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* cons
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(E(0) == '0'))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_ILLEGAL_ZERO_PREFIX,
 			pos + 1,
 			data_len - pos - 1
@@ -139,24 +137,101 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* cons
 			if (P(i) != E(i))
 				compare = P(i) < E(i) ? -1 : 1;
 		if (GS1_LINTER_UNLIKELY(compare == 1))
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_POSITION_EXCEEDS_END,
 				0,
 				data_len
 			);
 	} else if (GS1_LINTER_UNLIKELY(pos > data_len - pos - 1))
 		/* Non-zero prefix, so a length check is sufficient. */
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_POSITION_EXCEEDS_END,
 			0,
 			data_len
 		);
 
+	return GS1_LINTER_OK;
+
+}
+
+#undef P
+#undef E
+
+
+/**
+ * Used to ensure that an AI component conforms to a "`<pos>/<end>`" format for
+ * variable width `<pos>` and `<end>`.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_POSITION_IN_SEQUENCE_MALFORMED if the data does not conform to "`<pos>/<end>`" format.
+ * @return #GS1_LINTER_ILLEGAL_ZERO_PREFIX if either the position number or the end number are zero or contain a zero prefix.
+ * @return #GS1_LINTER_POSITION_EXCEEDS_END if the data contains a position number that is larger than the end position.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_posinseqslash(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = posinseqslash_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_posinseqslash() that also returns the position and
+ * the end of the sequence.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] piece Receives the decoded value if the data is valid, otherwise
+ *                    is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_posinseqslash()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_posinseqslash(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_piece_t* const piece)
+{
+
+	gs1_parse_piece_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(piece);
+
+	ret = posinseqslash_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*piece = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -210,6 +285,16 @@ void test_lint_posinseqslash(void)
 	UNIT_TEST_FAIL(gs1_lint_posinseqslash, "101/100", GS1_LINTER_POSITION_EXCEEDS_END, "*101/100*");
 	UNIT_TEST_FAIL(gs1_lint_posinseqslash, "999/998", GS1_LINTER_POSITION_EXCEEDS_END, "*999/998*");
 
+	{
+		gs1_parse_piece_t piece;
+
+		TEST_CHECK(gs1_parse_posinseqslash("7/12", 4, NULL, NULL, &piece) == GS1_LINTER_OK);
+		TEST_CHECK(piece.piece == 7 && piece.total == 12);
+
+		TEST_CHECK(gs1_parse_posinseqslash("12/7", 4, NULL, NULL, &piece) == GS1_LINTER_POSITION_EXCEEDS_END);
+		TEST_CHECK(piece.piece == 7);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
@@ -54,6 +54,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_winding(const char* const data
 {
 
 	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
 
 
 	/*
@@ -34,31 +34,14 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-#ifndef CURRENT_YEAR
-#define CURRENT_YEAR 21  ///< 20YY: For converting YY to 19YY, 20YY, 21YY, etc. for leap year validation
-#endif
-
-
-/**
- * Used to ensure that an AI component conforms to the YYMMDD or YYMM00
- * formats.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a date, recording it into `date` if it is not NULL. This is shared
+ *  by the linter and by gs1_parse_yymmd0().
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYMMDD format.
- * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYMMDD format.
- * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
- * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
- * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t yymmd0_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
 {
 
 /// \cond
@@ -66,6 +49,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data,
 /// \endcond
 
 	size_t pos;
+	int century;
 	char yyyymmdd[8];
 	gs1_lint_err_t ret;
 
@@ -76,7 +60,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data,
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(data_len != 6))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			(data_len < 6) ? GS1_LINTER_DATE_TOO_SHORT : GS1_LINTER_DATE_TOO_LONG,
 			0,
 			data_len
@@ -88,7 +72,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data,
 	 */
 	for (pos = 0; pos < 6; pos++) {
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_NON_DIGIT_CHARACTER,
 				pos,
 				1
@@ -101,15 +85,22 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data,
 	 * Convert YY to a year using a horizon based on CURRENT_YEAR.
 	 *
 	 */
-	if (YY - CURRENT_YEAR >= 51) {
-		yyyymmdd[0] = '1'; yyyymmdd[1] = '9';
-	} else if (YY - CURRENT_YEAR > -50) {
-		yyyymmdd[0] = '2'; yyyymmdd[1] = '0';
-	} else {
-		yyyymmdd[0] = '2'; yyyymmdd[1] = '1';	/* LCOV_EXCL_LINE */
-	}
+	century = gs1_lint_yy_to_year(YY) / 100;
+	yyyymmdd[0] = (char)('0' + century / 10);
+	yyyymmdd[1] = (char)('0' + century % 10);
 
+	/*
+	 * The date, with the year expanded, is recorded by the companion of
+	 * yyyymmd0 as it validates the data.
+	 *
+	 */
+#ifndef GS1_LINTER_NO_PARSE
+	ret = date ? gs1_parse_yyyymmd0(yyyymmdd, 8, err_pos, err_len, date) :
+		     gs1_lint_yyyymmd0(yyyymmdd, 8, err_pos, err_len);
+#else
+	(void)date;
 	ret = gs1_lint_yyyymmd0(yyyymmdd, 8, err_pos, err_len);
+#endif
 
 	assert(ret == GS1_LINTER_OK ||
 	       ret == GS1_LINTER_ILLEGAL_MONTH ||
@@ -119,17 +110,95 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data,
 	assert(!err_pos || !err_len || ret == GS1_LINTER_OK || (*err_pos + *err_len <= 8));
 
 	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			ret,
 			*err_pos - 2,
 			*err_len
 		);
 
+	return GS1_LINTER_OK;
+
+}
+
+#undef YY
+
+
+/**
+ * Used to ensure that an AI component conforms to the YYMMDD or YYMM00
+ * formats.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYMMDD format.
+ * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYMMDD format.
+ * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
+ * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
+ * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = yymmd0_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_yymmd0() that also returns the date that the data
+ * represents.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] date Receives the decoded value if the data is valid, otherwise
+ *                   is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_yymmd0()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
+{
+
+	gs1_parse_date_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(date);
+
+	ret = yymmd0_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*date = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -206,6 +275,18 @@ void test_lint_yymmd0(void)
 
 	UNIT_TEST_PASS(gs1_lint_yymmd0, "200600");		/* dd=00 permitted */
 
+	{
+		gs1_parse_date_t date;
+
+		TEST_CHECK(gs1_parse_yymmd0("250200", 6, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.year == 2025 && date.month == 2 && date.day == 0 && date.epoch_day == 20147);
+		TEST_CHECK(gs1_parse_yymmd0("991231", 6, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.year == 1999 && date.epoch_day == 10956);
+
+		TEST_CHECK(gs1_parse_yymmd0("991232", 6, NULL, NULL, &date) == GS1_LINTER_ILLEGAL_DAY);
+		TEST_CHECK(date.day == 31);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
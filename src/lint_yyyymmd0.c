@@ -33,25 +33,15 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to ensure that an AI component conforms to the YYYYMMDD or YYYYMM00 formats.
- *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
+/*
+ *  Validate a date, recording it into `date` if it is not NULL. This is shared
+ *  by the linter, by gs1_parse_yyyymmd0() and, through the latter, by the
+ *  companions of the other date linters.
  *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYYYMMDD format.
- * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYYYMMDD format.
- * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
- * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
- * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t yyyymmd0_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
 {
 
 /// \cond
@@ -74,7 +64,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const dat
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(data_len != 8))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			(data_len < 8) ? GS1_LINTER_DATE_TOO_SHORT : GS1_LINTER_DATE_TOO_LONG,
 			0,
 			data_len
@@ -86,7 +76,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const dat
 	 */
 	for (pos = 0; pos < 8; pos++) {
 		if (GS1_LINTER_UNLIKELY(data[pos] < '0' || data[pos] > '9'))
-			GS1_LINTER_RETURN_ERROR(
+			GS1_LINTER_DECODE_ERROR(
 				GS1_LINTER_NON_DIGIT_CHARACTER,
 				pos,
 				1
@@ -98,7 +88,7 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const dat
 	 *
 	 */
 	if (GS1_LINTER_UNLIKELY(MM < 1 || MM > 12))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_ILLEGAL_MONTH,
 			4,
 			2
@@ -115,17 +105,100 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const dat
 	}
 
 	if (GS1_LINTER_UNLIKELY(DD > maxdd))		/* Permit "00" */
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_ILLEGAL_DAY,
 			6,
 			2
 		);
 
+	if (date)
+		gs1_parse_date_set(date, YY, MM, DD);
+
+	return GS1_LINTER_OK;
+
+}
+
+#undef XX
+#undef YY
+#undef MM
+#undef DD
+
+
+/**
+ * Used to ensure that an AI component conforms to the YYYYMMDD or YYYYMM00 formats.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYYYMMDD format.
+ * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYYYMMDD format.
+ * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
+ * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
+ * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = yyyymmd0_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_yyyymmd0() that also returns the date that the data
+ * represents.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] date Receives the decoded value if the data is valid, otherwise
+ *                   is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_yyyymmd0()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yyyymmd0(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
+{
+
+	gs1_parse_date_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(date);
+
+	ret = yyyymmd0_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*date = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -220,6 +293,27 @@ void test_lint_yyyymmd0(void)
 
 	UNIT_TEST_PASS(gs1_lint_yyyymmd0, "20200600");		/* dd=00 permitted */
 
+	{
+		gs1_parse_date_t date;
+
+		TEST_CHECK(gs1_parse_yyyymmd0("19700101", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.year == 1970 && date.month == 1 && date.day == 1 && date.epoch_day == 0);
+		TEST_CHECK(gs1_parse_yyyymmd0("20240229", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.epoch_day == 19782);
+		TEST_CHECK(gs1_parse_yyyymmd0("20240200", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.day == 0 && date.epoch_day == 19782);
+		TEST_CHECK(gs1_parse_yyyymmd0("19991200", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.epoch_day == 10956);
+		TEST_CHECK(gs1_parse_yyyymmd0("00000101", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.year == 0 && date.epoch_day == -719528);
+		TEST_CHECK(gs1_parse_yyyymmd0("99991231", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.epoch_day == 2932896);
+
+		date.year = 1;
+		TEST_CHECK(gs1_parse_yyyymmd0("20230229", 8, NULL, NULL, &date) == GS1_LINTER_ILLEGAL_DAY);
+		TEST_CHECK(date.year == 1);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
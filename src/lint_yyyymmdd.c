@@ -32,32 +32,32 @@
 #include "gs1syntaxdictionary-utils.h"
 
 
-/**
- * Used to ensure that an AI component conforms to the YYYYMMDD format.
+/*
+ *  Validate a date, recording it into `date` if it is not NULL. This is shared
+ *  by the linter and by gs1_parse_yyyymmdd().
  *
- * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
- * @param [in] data_len Length of the data to be linted.
- * @param [out] err_pos To facilitate error highlighting, the start position of
- *                      the bad data is written to this pointer, if not `NULL`.
- * @param [out] err_len The length of the bad data is written to this pointer, if
- *                      not `NULL`.
- *
- * @return #GS1_LINTER_OK if okay.
- * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYYYMMDD format.
- * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYYYMMDD format.
- * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
- * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
- * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *  Returns as for the linter, but without updating the linter statistics.
  *
  */
-GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmdd(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+static GS1_LINTER_ALWAYS_INLINE gs1_lint_err_t yyyymmdd_decode(const char* const data, const size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
 {
 
 	gs1_lint_err_t ret;
 
 	assert(data);
 
+	/*
+	 * The date is recorded by the companion of yyyymmd0 as it validates
+	 * the data.
+	 *
+	 */
+#ifndef GS1_LINTER_NO_PARSE
+	ret = date ? gs1_parse_yyyymmd0(data, data_len, err_pos, err_len, date) :
+		     gs1_lint_yyyymmd0(data, data_len, err_pos, err_len);
+#else
+	(void)date;
 	ret = gs1_lint_yyyymmd0(data, data_len, err_pos, err_len);
+#endif
 
 	assert(ret == GS1_LINTER_OK ||
 	       ret == GS1_LINTER_DATE_TOO_SHORT ||
@@ -67,24 +67,99 @@ GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmdd(const char* const dat
 	       ret == GS1_LINTER_ILLEGAL_DAY);
 
 	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			ret,
 			*err_pos,
 			*err_len
 		);
 
 	if (GS1_LINTER_UNLIKELY(data[6] == '0' && data[7] == '0'))
-		GS1_LINTER_RETURN_ERROR(
+		GS1_LINTER_DECODE_ERROR(
 			GS1_LINTER_ILLEGAL_DAY,
 			6,
 			2
 		);
 
+	return GS1_LINTER_OK;
+
+}
+
+
+/**
+ * Used to ensure that an AI component conforms to the YYYYMMDD format.
+ *
+ * @param [in] data Pointer to the data to be linted. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be linted.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ *
+ * @return #GS1_LINTER_OK if okay.
+ * @return #GS1_LINTER_DATE_TOO_SHORT if the data is too short for YYYYMMDD format.
+ * @return #GS1_LINTER_DATE_TOO_LONG if the data is too long for YYYYMMDD format.
+ * @return #GS1_LINTER_NON_DIGIT_CHARACTER if the data contains a non-digit character.
+ * @return #GS1_LINTER_ILLEGAL_MONTH if the data contains an invalid month.
+ * @return #GS1_LINTER_ILLEGAL_DAY if the data contains an invalid day of the month.
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_lint_yyyymmdd(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len)
+{
+
+	gs1_lint_err_t ret;
+
+	assert(data);
+	GS1_LINTER_PROBE_ENTRY();
+
+	ret = yyyymmdd_decode(data, data_len, err_pos, err_len, NULL);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		GS1_LINTER_RETURN_ERROR(ret, *err_pos, *err_len);
+
 	GS1_LINTER_RETURN_OK;
 
 }
 
 
+#ifndef GS1_LINTER_NO_PARSE
+
+/**
+ * Companion to gs1_lint_yyyymmdd() that also returns the date that the data
+ * represents.
+ *
+ * @param [in] data Pointer to the data to be parsed. Must not be `NULL`.
+ * @param [in] data_len Length of the data to be parsed.
+ * @param [out] err_pos To facilitate error highlighting, the start position of
+ *                      the bad data is written to this pointer, if not `NULL`.
+ * @param [out] err_len The length of the bad data is written to this pointer, if
+ *                      not `NULL`.
+ * @param [out] date Receives the decoded value if the data is valid, otherwise
+ *                   is unchanged. Must not be `NULL`.
+ *
+ * @return as for gs1_lint_yyyymmdd()
+ *
+ */
+GS1_SYNTAX_DICTIONARY_API gs1_lint_err_t gs1_parse_yyyymmdd(const char* const data, size_t data_len, size_t* const err_pos, size_t* const err_len, gs1_parse_date_t* const date)
+{
+
+	gs1_parse_date_t decoded;
+	gs1_lint_err_t ret;
+
+	assert(data);
+	assert(date);
+
+	ret = yyyymmdd_decode(data, data_len, err_pos, err_len, &decoded);
+	if (GS1_LINTER_UNLIKELY(ret != GS1_LINTER_OK))
+		return ret;
+
+	*date = decoded;
+
+	return GS1_LINTER_OK;
+
+}
+
+#endif  /* GS1_LINTER_NO_PARSE */
+
+
 #ifdef UNIT_TESTS
 
 #include "unittest.h"
@@ -165,6 +240,17 @@ void test_lint_yyyymmdd(void)
 
 	UNIT_TEST_FAIL(gs1_lint_yyyymmdd, "20200600", GS1_LINTER_ILLEGAL_DAY, "202006*00*");	/* dd=00 forbidden */
 
+	{
+		gs1_parse_date_t date;
+
+		TEST_CHECK(gs1_parse_yyyymmdd("20250718", 8, NULL, NULL, &date) == GS1_LINTER_OK);
+		TEST_CHECK(date.year == 2025 && date.month == 7 && date.day == 18 && date.epoch_day == 20287);
+
+		date.day = 1;
+		TEST_CHECK(gs1_parse_yyyymmdd("20250700", 8, NULL, NULL, &date) == GS1_LINTER_ILLEGAL_DAY);
+		TEST_CHECK(date.day == 1);
+	}
+
 }
 
 #endif  /* UNIT_TESTS */
@@ -29,6 +29,7 @@
 
 #define UNIT_TEST_PASS(f, g) DO_UNIT_TEST(1, f, g, 0, NULL, __FILE__, __LINE__)
 #define UNIT_TEST_FAIL(f, g, e, h) DO_UNIT_TEST(0, f, g, e, h, __FILE__, __LINE__)
+#define UNIT_TEST_VALID(f, v, g) DO_UNIT_TEST_VALID(f, v, g, __FILE__, __LINE__)
 
 static void DO_UNIT_TEST(int should_succeed, gs1_lint_err_t (*fn)(const char *, size_t, size_t *, size_t *), const char *data, gs1_lint_err_t expect_err, const char *expect_highlight, const char *file, int line) {
 
@@ -70,4 +71,41 @@ static void DO_UNIT_TEST(int should_succeed, gs1_lint_err_t (*fn)(const char *,
 
 }
 
+/*
+ *  Check that a validity-only variant of a linter agrees with the linter for
+ *  each prefix of some valid data and for each byte value at each position.
+ *
+ */
+static inline void DO_UNIT_TEST_VALID(gs1_lint_err_t (*fn)(const char *, size_t, size_t *, size_t *), bool (*valid_fn)(const char *, size_t), const char *data, const char *file, int line) {
+
+	char buf[100];
+	char casestr[512] = {0};
+	const size_t len = strlen(data);
+	size_t pos, mismatches = 0;
+	int c;
+
+	snprintf(casestr, sizeof(casestr), "%s %s:%d", data, file, line);
+	TEST_CASE(casestr);
+
+	TEST_ASSERT(len < sizeof(buf));
+	TEST_ASSERT(valid_fn(data, len));
+
+	for (pos = 0; pos <= len; pos++)
+		if (valid_fn(data, pos) != ((fn)(data, pos, NULL, NULL) == GS1_LINTER_OK))
+			mismatches++;
+
+	for (pos = 0; pos < len; pos++) {
+		for (c = 0; c < 256; c++) {
+			memcpy(buf, data, len);
+			buf[pos] = (char)c;
+			if (valid_fn(buf, len) != ((fn)(buf, len, NULL, NULL) == GS1_LINTER_OK))
+				mismatches++;
+		}
+	}
+
+	TEST_CHECK(mismatches == 0);
+	TEST_MSG("Disagreements with the linter: %lu", (unsigned long)mismatches);
+
+}
+
 #endif  /* LINT_UNIT_TEST */